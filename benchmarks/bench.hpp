@@ -0,0 +1,153 @@
+#pragma once
+
+// Minimal benchmark harness shared by the feer benchmarks: wall time per operation plus, on Linux,
+// hardware counters read through perf_event_open. Counters that the kernel or the CPU do not
+// provide (containers, VMs, perf_event_paranoid) are reported as "n/a".
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace feer::bench {
+
+/** Prevents the compiler from discarding value. */
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+/** Hardware counters of one measured region. A value of -1 means unavailable. */
+struct CounterValues {
+    std::int64_t cycles = -1;
+    std::int64_t instructions = -1;
+    std::int64_t branch_misses = -1;
+    std::int64_t icache_misses = -1;
+};
+
+class Counters {
+public:
+    Counters() {
+#if defined(__linux__)
+        m_fds[0] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        m_fds[1] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        m_fds[2] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        m_fds[3] = open(
+            PERF_TYPE_HW_CACHE,
+            PERF_COUNT_HW_CACHE_L1I | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+#endif
+    }
+
+    ~Counters() {
+#if defined(__linux__)
+        for (const int fd : m_fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    Counters(const Counters&) = delete;
+    Counters& operator=(const Counters&) = delete;
+
+    void start() {
+#if defined(__linux__)
+        for (const int fd : m_fds) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    CounterValues stop() {
+        CounterValues values;
+#if defined(__linux__)
+        std::array<std::int64_t, 4> raw{-1, -1, -1, -1};
+        for (std::size_t i = 0; i < m_fds.size(); ++i) {
+            if (m_fds[i] >= 0) {
+                ioctl(m_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+                std::int64_t count = 0;
+                if (read(m_fds[i], &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count))) {
+                    raw[i] = count;
+                }
+            }
+        }
+        values = CounterValues{raw[0], raw[1], raw[2], raw[3]};
+#endif
+        return values;
+    }
+
+private:
+#if defined(__linux__)
+    static int open(std::uint32_t type, std::uint64_t config) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    std::array<int, 4> m_fds{-1, -1, -1, -1};
+#endif
+};
+
+/**
+ * @brief Runs fn(iteration) iterations times and prints time and counters per operation.
+ */
+template <typename Fn>
+void run(std::string_view name, std::size_t iterations, Fn&& fn) {
+    Counters counters;
+    const auto begin = std::chrono::steady_clock::now();
+    counters.start();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        fn(i);
+    }
+    const CounterValues values = counters.stop();
+    const auto end = std::chrono::steady_clock::now();
+
+    const double ops = static_cast<double>(iterations);
+    const auto per_op = [&](std::int64_t value, char* buffer, std::size_t size) {
+        if (value < 0) {
+            std::snprintf(buffer, size, "%8s", "n/a");
+        } else {
+            std::snprintf(buffer, size, "%8.3f", static_cast<double>(value) / ops);
+        }
+        return buffer;
+    };
+
+    char cycles[16];
+    char instructions[16];
+    char branch_misses[16];
+    char icache_misses[16];
+    std::printf(
+        "%-36.*s %8.2f ns/op  cycles %s  instr %s  br-miss %s  L1i-miss %s\n",
+        static_cast<int>(name.size()),
+        name.data(),
+        std::chrono::duration<double, std::nano>(end - begin).count() / ops,
+        per_op(values.cycles, cycles, sizeof(cycles)),
+        per_op(values.instructions, instructions, sizeof(instructions)),
+        per_op(values.branch_misses, branch_misses, sizeof(branch_misses)),
+        per_op(values.icache_misses, icache_misses, sizeof(icache_misses)));
+}
+
+}  // namespace feer::bench
@@ -0,0 +1,63 @@
+// Propagating a Result<Frame> with a 1 KiB payload up through eight non-inlined frames, the
+// value produced at the bottom and read at the top. Built twice: with the Frame stored inline and
+// with FEER_BOX_THRESHOLD=64, where every frame moves a pointer instead of the payload.
+
+#include "../bench.hpp"
+
+#include <feer/result.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+
+namespace {
+
+constexpr std::size_t iterations = 1 << 20;
+
+struct Frame {
+    std::array<std::uint64_t, 128> words;
+};
+
+[[gnu::noinline]] feer::Result<Frame> produce(std::size_t i, unsigned error_percent) {
+    if (i % 100 < error_percent) {
+        return feer::Err{"frame dropped"};
+    }
+    Frame frame;
+    frame.words[0] = i;
+    frame.words[127] = i;
+    return frame;
+}
+
+template <int Depth>
+[[gnu::noinline]] feer::Result<Frame> propagate(std::size_t i, unsigned error_percent) {
+    if constexpr (Depth == 0) {
+        return produce(i, error_percent);
+    } else {
+        feer::Result<Frame> result = propagate<Depth - 1>(i, error_percent);
+        if (result.is_err()) {
+            return std::move(result.error());
+        }
+        return result;
+    }
+}
+
+}  // namespace
+
+int main() {
+    std::printf(
+        "mode: %s, sizeof(Result<Frame>) %zu\n",
+        feer::box_value<Frame> ? "boxed" : "inline",
+        sizeof(feer::Result<Frame>));
+
+    for (const unsigned error_percent : {0U, 10U, 90U, 100U}) {
+        char name[64];
+        std::snprintf(name, sizeof(name), "propagate 8 frames, %u%% errors", error_percent);
+        feer::bench::run(name, iterations, [&](std::size_t i) {
+            const feer::Result<Frame> result = propagate<8>(i, error_percent);
+            feer::bench::do_not_optimize(result.is_ok() ? result.value().words[127] : 0);
+        });
+    }
+    return 0;
+}
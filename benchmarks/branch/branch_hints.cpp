@@ -0,0 +1,81 @@
+// Cost of Result state checks at different error rates under the three FEER_BRANCH_HINTS policies.
+// CMake builds this file once per policy (feer_bench_branch_ok, _err, _none); compare their output.
+// Branch misses show how well the hinted layout matches the real distribution; L1i misses show
+// the effect of moving cold error handling out of the hot instruction stream.
+
+#include "../bench.hpp"
+
+#include <feer/result.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t input_count = 1 << 16;
+constexpr std::size_t iterations = 1 << 24;
+
+[[gnu::noinline]] feer::Result<std::uint32_t> parse(std::uint32_t input) {
+    if ((input & 1U) != 0) {
+        return feer::Err{"odd input"};
+    }
+    return input >> 1;
+}
+
+[[gnu::noinline]] std::uint64_t recover(const feer::Err& err) {
+    std::uint64_t hash = 0;
+    for (const char c : err.message) {
+        hash = hash * 31 + static_cast<unsigned char>(c);
+    }
+    return hash & 0xff;
+}
+
+std::vector<std::uint32_t> make_inputs(unsigned error_percent) {
+    std::vector<std::uint32_t> inputs(input_count);
+    std::uint64_t state = 0x9e3779b97f4a7c15ULL;
+    for (std::uint32_t& input : inputs) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const bool fail = state % 100 < error_percent;
+        input = (static_cast<std::uint32_t>(state >> 32) & ~1U) | (fail ? 1U : 0U);
+    }
+    return inputs;
+}
+
+const char* policy_name() {
+#if FEER_BRANCH_HINTS == FEER_BRANCH_HINTS_OK
+    return "ok-likely";
+#elif FEER_BRANCH_HINTS == FEER_BRANCH_HINTS_ERR
+    return "err-likely";
+#else
+    return "no-hints";
+#endif
+}
+
+}  // namespace
+
+int main() {
+    std::printf("policy: %s\n", policy_name());
+
+    for (const unsigned error_percent : {0U, 1U, 10U, 50U, 90U, 100U}) {
+        const std::vector<std::uint32_t> inputs = make_inputs(error_percent);
+        std::uint64_t sum = 0;
+
+        const std::string match_name = "match, " + std::to_string(error_percent) + "% errors";
+        feer::bench::run(match_name, iterations, [&](std::size_t i) {
+            sum += parse(inputs[i & (input_count - 1)])
+                       .match([](std::uint32_t value) -> std::uint64_t { return value; }, &recover);
+        });
+
+        const std::string value_or_name = "value_or, " + std::to_string(error_percent) + "% errors";
+        feer::bench::run(value_or_name, iterations, [&](std::size_t i) {
+            sum += parse(inputs[i & (input_count - 1)]).value_or(7U);
+        });
+
+        feer::bench::do_not_optimize(sum);
+    }
+    return 0;
+}
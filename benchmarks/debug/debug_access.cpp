@@ -0,0 +1,68 @@
+// Result accessor overhead in unoptimized builds. CMake compiles this file at -O0 (/Od) twice:
+// feer_bench_debug_default and feer_bench_debug_perf (FEER_DEBUG_PERF=1). Each prints the cost of
+// the same loop over a raw struct as the baseline.
+
+#include "../bench.hpp"
+
+#include <feer/result.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t element_count = 1024;
+constexpr std::size_t iterations = 1 << 22;
+
+struct Vec3 {
+    float x;
+    float y;
+    float z;
+};
+
+struct RawResult {
+    Vec3 value;
+    bool ok;
+};
+
+}  // namespace
+
+int main() {
+    std::printf("FEER_DEBUG_PERF=%d\n", FEER_DEBUG_PERF);
+
+    std::vector<RawResult> raw(element_count, RawResult{{1.0F, 2.0F, 3.0F}, true});
+    std::vector<feer::Result<Vec3>> results(element_count, feer::Result<Vec3>{Vec3{1.0F, 2.0F, 3.0F}});
+    float sum = 0.0F;
+
+    feer::bench::run("raw struct .value.x", iterations, [&](std::size_t i) {
+        const RawResult& r = raw[i & (element_count - 1)];
+        if (r.ok) {
+            sum += r.value.x;
+        }
+    });
+
+    feer::bench::run("Result::value().x", iterations, [&](std::size_t i) {
+        const feer::Result<Vec3>& r = results[i & (element_count - 1)];
+        if (r.is_ok()) {
+            sum += r.value().x;
+        }
+    });
+
+    feer::bench::run("Result::value_or().x", iterations, [&](std::size_t i) {
+        sum += results[i & (element_count - 1)].value_or(Vec3{}).x;
+    });
+
+    feer::bench::run("Result::match()", iterations, [&](std::size_t i) {
+        sum += results[i & (element_count - 1)].match(
+            [](const Vec3& v) { return v.x; }, [](const feer::Err&) { return 0.0F; });
+    });
+
+    feer::bench::run("Result<Vec3> construct + value()", iterations, [&](std::size_t i) {
+        feer::Result<Vec3> r = Vec3{static_cast<float>(i), 0.0F, 0.0F};
+        sum += r.value().x;
+    });
+
+    feer::bench::do_not_optimize(sum);
+    return 0;
+}
@@ -0,0 +1,156 @@
+// Error storm: every thread keeps failing with errors carrying a 48-byte payload, which does not
+// fit inside Err and is stored out of line. Half of each batch is dropped locally, the other half
+// is handed to the next thread and freed there. Built twice, with the per-thread node pool and
+// with FEER_ERR_NODE_POOL=0 (global new/delete), and reports errors per second by thread count.
+//
+// The pool only serves payloads: Err::message is a std::string, so a message longer than its
+// small-string buffer is still allocated by every failure. Each run is repeated with a short and a
+// long message, and the heap allocations counted per error show which of them remain.
+
+#include "../bench.hpp"
+
+#include <feer/result.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if !FEER_ERR_PAYLOADS
+#error "error_storm needs FEER_ERR_PAYLOADS=1"
+#endif
+
+namespace {
+
+// Global allocations made by the current thread, counted by the replaced operator new below.
+thread_local std::uint64_t thread_allocations = 0;
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    ++thread_allocations;
+    if (void* ptr = std::malloc(size != 0 ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+constexpr std::size_t batch_size = 256;
+constexpr std::size_t batches_per_thread = 4096;
+
+struct Failure {
+    std::array<std::uint64_t, 6> context;
+};
+
+// Fits the small-string buffer of libstdc++ and libc++; the long one does not.
+constexpr const char* short_message = "unavailable";
+constexpr const char* long_message = "backend unavailable";
+
+[[gnu::noinline]] feer::Result<int> fetch(std::uint64_t key, const char* message) {
+    if ((key & 7U) != 7U) {
+        return feer::Err{message}.attach(Failure{{key, key + 1, key + 2, key + 3, key + 4, key + 5}});
+    }
+    return static_cast<int>(key);
+}
+
+struct Mailbox {
+    std::mutex mutex;
+    std::vector<feer::Result<int>> results;
+};
+
+struct StormStats {
+    double errors_per_second;
+    double allocations_per_error;
+};
+
+StormStats storm(std::size_t thread_count, const char* message) {
+    std::vector<Mailbox> mailboxes(thread_count);
+    std::atomic<std::uint64_t> fetch_allocations{0};
+
+    const auto worker = [&](std::size_t self) {
+        std::uint64_t allocations = 0;
+        std::vector<feer::Result<int>> kept;
+        std::vector<feer::Result<int>> passed;
+        std::vector<feer::Result<int>> received;
+        for (std::size_t batch = 0; batch < batches_per_thread; ++batch) {
+            for (std::size_t i = 0; i < batch_size; ++i) {
+                const std::uint64_t before = thread_allocations;
+                feer::Result<int> result = fetch(batch * batch_size + i, message);
+                allocations += thread_allocations - before;
+                (i % 2 == 0 ? kept : passed).push_back(std::move(result));
+            }
+            kept.clear();
+
+            Mailbox& next = mailboxes[(self + 1) % thread_count];
+            {
+                const std::lock_guard lock{next.mutex};
+                next.results.swap(passed);
+            }
+            passed.clear();
+
+            Mailbox& own = mailboxes[self];
+            {
+                const std::lock_guard lock{own.mutex};
+                received.swap(own.results);
+            }
+            feer::bench::do_not_optimize(received.size());
+            received.clear();
+        }
+        fetch_allocations.fetch_add(allocations, std::memory_order_relaxed);
+    };
+
+    const auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back(worker, t);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double errors = static_cast<double>(thread_count * batches_per_thread * batch_size) * 7.0 / 8.0;
+    return StormStats{
+        errors / std::chrono::duration<double>(end - begin).count(),
+        static_cast<double>(fetch_allocations.load()) / errors};
+}
+
+}  // namespace
+
+int main() {
+    std::printf(
+        "allocator: %s, hardware threads: %u\n",
+        FEER_ERR_NODE_POOL ? "per-thread node pool" : "global new/delete",
+        std::thread::hardware_concurrency());
+    for (const char* message : {short_message, long_message}) {
+        std::printf("message \"%s\" (%zu bytes)\n", message, std::string{message}.size());
+        for (std::size_t threads = 1; threads <= 8; threads *= 2) {
+            const StormStats stats = storm(threads, message);
+            std::printf(
+                "%2zu threads %10.2f M errors/s %6.2f allocations/error\n",
+                threads,
+                stats.errors_per_second / 1e6,
+                stats.allocations_per_error);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+// Cost of creating, copying and comparing errors whose messages repeat, as in a cache of failed
+// lookups. Built twice: with plain std::string messages and with FEER_INTERN_MESSAGES=1, where
+// equal messages share one interned copy. The creation run uses several threads to exercise the
+// striped intern table.
+
+#include "../bench.hpp"
+
+#include <feer/result.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t cached_errors = 4096;
+constexpr std::size_t distinct_messages = 16;
+constexpr std::size_t thread_count = 8;
+constexpr std::size_t iterations = 1 << 12;
+
+std::string peer_message(std::size_t i) {
+    return "connection reset by peer: 10.0.0." + std::to_string(i % distinct_messages);
+}
+
+std::vector<feer::Err> make_cache() {
+    std::vector<feer::Err> cache;
+    cache.reserve(cached_errors);
+    for (std::size_t i = 0; i < cached_errors; ++i) {
+        cache.emplace_back(peer_message(i));
+    }
+    return cache;
+}
+
+}  // namespace
+
+int main() {
+    std::printf("mode: %s, sizeof(Err) %zu\n", FEER_INTERN_MESSAGES ? "interned" : "std::string", sizeof(feer::Err));
+
+    const std::vector<feer::Err> cache = make_cache();
+
+    feer::bench::run("copy 4096 cached errors", iterations, [&](std::size_t) {
+        std::vector<feer::Err> copy = cache;
+        feer::bench::do_not_optimize(copy.data());
+    });
+
+    feer::bench::run("compare 4096 messages", iterations, [&](std::size_t i) {
+        const feer::Err& probe = cache[i % cached_errors];
+        std::size_t equal = 0;
+        for (const feer::Err& err : cache) {
+            equal += err.message == probe.message ? 1 : 0;
+        }
+        feer::bench::do_not_optimize(equal);
+    });
+
+    feer::bench::run("create 4096 errors x 8 threads", iterations / 64, [&](std::size_t) {
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([] { feer::bench::do_not_optimize(make_cache().size()); });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    });
+
+    return 0;
+}
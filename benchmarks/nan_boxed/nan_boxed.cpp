@@ -0,0 +1,77 @@
+// Element-wise kernel writing one Result<double> per input, then an unwrap pass replacing errors
+// with a fallback via value_or, for the Err-based Result<double> and the eight-byte
+// Result<double, NanBoxed>. Array sizes span cache-resident to DRAM-resident outputs; the
+// NaN-boxed unwrap is a compare-and-select over doubles the compiler can vectorize.
+
+#include "../bench.hpp"
+
+#include <feer/nan_boxed.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t elements_per_size = std::size_t{1} << 26;
+
+template <typename R>
+R safe_sqrt(double x) {
+    if (x < 0.0) [[unlikely]] {
+        return feer::Err{"negative input"};
+    }
+    return std::sqrt(x);
+}
+
+std::vector<double> make_inputs(std::size_t count) {
+    std::vector<double> inputs(count);
+    std::uint64_t state = 0x9e3779b97f4a7c15ULL;
+    for (double& input : inputs) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const double magnitude = static_cast<double>(state >> 11) * 0x1p-53 * 1000.0;
+        input = state % 100 == 0 ? -magnitude : magnitude;
+    }
+    return inputs;
+}
+
+template <typename R>
+void measure(const char* layout, const std::vector<double>& inputs) {
+    std::vector<R> outputs(inputs.size(), R{0.0});
+    const std::size_t passes = elements_per_size / inputs.size();
+    const std::string suffix = std::string{", "} + layout + ", " + std::to_string(inputs.size() * sizeof(R) >> 10) + " KiB";
+
+    feer::bench::run("kernel" + suffix, passes, [&](std::size_t) {
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            outputs[i] = safe_sqrt<R>(inputs[i]);
+        }
+        feer::bench::do_not_optimize(outputs.data());
+    });
+
+    std::vector<double> values(inputs.size());
+    feer::bench::run("unwrap" + suffix, passes, [&](std::size_t) {
+        for (std::size_t i = 0; i < outputs.size(); ++i) {
+            values[i] = outputs[i].value_or(0.0);
+        }
+        feer::bench::do_not_optimize(values.data());
+    });
+}
+
+}  // namespace
+
+int main() {
+    std::printf("sizeof(Result<double>) = %zu, sizeof(Result<double, NanBoxed>) = %zu\n",
+                sizeof(feer::Result<double>),
+                sizeof(feer::Result<double, feer::NanBoxed>));
+    std::printf("times are per pass over the array\n");
+
+    for (const std::size_t count : {std::size_t{1} << 10, std::size_t{1} << 14, std::size_t{1} << 20}) {
+        const std::vector<double> inputs = make_inputs(count);
+        measure<feer::Result<double>>("Err", inputs);
+        measure<feer::Result<double, feer::NanBoxed>>("NanBoxed", inputs);
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+// Return-and-inspect cost of a small value or error code through a non-inlined call, for
+// PackedResult (one register), std::variant<std::uint32_t, Status> and Result<std::uint32_t>.
+// Error percentages show how each layout behaves once the error path stops being rare.
+
+#include "../bench.hpp"
+
+#include <feer/packed.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t input_count = 1 << 16;
+constexpr std::size_t iterations = 1 << 24;
+
+enum class Status : std::uint8_t { ok, truncated, bad_checksum };
+
+[[gnu::noinline]] feer::PackedResult<std::uint32_t, Status> parse_packed(std::uint32_t input) {
+    if ((input & 1U) != 0) {
+        return Status::bad_checksum;
+    }
+    return input >> 1;
+}
+
+[[gnu::noinline]] std::variant<std::uint32_t, Status> parse_variant(std::uint32_t input) {
+    if ((input & 1U) != 0) {
+        return Status::bad_checksum;
+    }
+    return input >> 1;
+}
+
+[[gnu::noinline]] feer::Result<std::uint32_t> parse_result(std::uint32_t input) {
+    if ((input & 1U) != 0) {
+        return feer::Err{"bad checksum"};
+    }
+    return input >> 1;
+}
+
+std::vector<std::uint32_t> make_inputs(unsigned error_percent) {
+    std::vector<std::uint32_t> inputs(input_count);
+    std::uint64_t state = 0x9e3779b97f4a7c15ULL;
+    for (std::uint32_t& input : inputs) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const bool fail = state % 100 < error_percent;
+        input = (static_cast<std::uint32_t>(state >> 32) & ~1U) | (fail ? 1U : 0U);
+    }
+    return inputs;
+}
+
+}  // namespace
+
+int main() {
+    std::printf("sizeof: PackedResult %zu, std::variant %zu, Result %zu\n",
+                sizeof(feer::PackedResult<std::uint32_t, Status>),
+                sizeof(std::variant<std::uint32_t, Status>),
+                sizeof(feer::Result<std::uint32_t>));
+
+    for (const unsigned error_percent : {0U, 5U, 50U}) {
+        const std::vector<std::uint32_t> inputs = make_inputs(error_percent);
+        const std::string suffix = ", " + std::to_string(error_percent) + "% errors";
+        std::uint64_t sum = 0;
+
+        feer::bench::run("PackedResult match" + suffix, iterations, [&](std::size_t i) {
+            sum += parse_packed(inputs[i & (input_count - 1)])
+                       .match([](std::uint32_t value) -> std::uint64_t { return value; },
+                              [](Status status) -> std::uint64_t { return static_cast<std::uint64_t>(status); });
+        });
+
+        feer::bench::run("PackedResult value_or" + suffix, iterations, [&](std::size_t i) {
+            sum += parse_packed(inputs[i & (input_count - 1)]).value_or(7U);
+        });
+
+        feer::bench::run("std::variant visit" + suffix, iterations, [&](std::size_t i) {
+            const auto parsed = parse_variant(inputs[i & (input_count - 1)]);
+            if (const auto* value = std::get_if<std::uint32_t>(&parsed)) {
+                sum += *value;
+            } else {
+                sum += static_cast<std::uint64_t>(std::get<Status>(parsed));
+            }
+        });
+
+        feer::bench::run("Result value_or" + suffix, iterations, [&](std::size_t i) {
+            sum += parse_result(inputs[i & (input_count - 1)]).value_or(7U);
+        });
+
+        feer::bench::do_not_optimize(sum);
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+// Parallel writers: every thread owns four consecutive Result<std::uint64_t> slots and keeps
+// rewriting them, one error per 64 writes. Compares a plain vector of slots, where neighbouring
+// threads share cache lines, with PaddedResultArray laid out one slot per cache line and in one
+// chunk per thread, and reports writes per second from 1 to 64 threads.
+
+#include "../bench.hpp"
+
+#include <feer/padded.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t slots_per_thread = 4;
+constexpr std::size_t writes_per_thread = std::size_t{1} << 20;
+
+feer::Result<std::uint64_t> produce(std::uint64_t n) {
+    if ((n & 63U) == 63U) {
+        return feer::Err{"sample rejected"};
+    }
+    return n * 2654435761U;
+}
+
+template <typename Write>
+double run_threads(std::size_t thread_count, const Write& write) {
+    const auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&write, t] {
+            for (std::size_t n = 0; n < writes_per_thread; ++n) {
+                write(t * slots_per_thread + n % slots_per_thread, n);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return static_cast<double>(thread_count * writes_per_thread) / std::chrono::duration<double>(end - begin).count();
+}
+
+double packed(std::size_t thread_count) {
+    std::vector<std::optional<feer::Result<std::uint64_t>>> slots(thread_count * slots_per_thread);
+    const double rate = run_threads(thread_count, [&](std::size_t index, std::uint64_t n) {
+        slots[index].emplace(produce(n));
+    });
+    feer::bench::do_not_optimize(slots.front()->is_ok());
+    return rate;
+}
+
+double padded(std::size_t thread_count, std::size_t chunks) {
+    feer::PaddedResultArray<std::uint64_t> slots{thread_count * slots_per_thread, chunks};
+    const double rate = run_threads(thread_count, [&](std::size_t index, std::uint64_t n) {
+        slots.emplace(index, produce(n));
+    });
+    const std::vector<feer::Result<std::uint64_t>> results = slots.compact();
+    feer::bench::do_not_optimize(results.front().is_ok());
+    return rate;
+}
+
+}  // namespace
+
+int main() {
+    std::printf(
+        "cache line: %zu bytes, hardware threads: %u\n", feer::cache_line_size, std::thread::hardware_concurrency());
+    std::printf("threads %14s %14s %14s  (M writes/s)\n", "packed", "per line", "per thread");
+    for (std::size_t threads = 1; threads <= 64; threads *= 2) {
+        const double plain = packed(threads);
+        const double per_line = padded(threads, 0);
+        const double per_thread = padded(threads, threads);
+        std::printf("%7zu %14.2f %14.2f %14.2f\n", threads, plain / 1e6, per_line / 1e6, per_thread / 1e6);
+    }
+    return 0;
+}
@@ -0,0 +1,35 @@
+# Compiles many_results.cpp as C++23 with and without FEER_DEDUCING_THIS and prints the best of
+# three compile times and the resulting .text sizes. Invoked by the feer_deducing_this_report
+# target with CXX, INCLUDE_DIR, SOURCE, OUT_DIR and SIZE_TOOL set.
+
+include(${CMAKE_CURRENT_LIST_DIR}/text_size.cmake)
+
+function(feer_timed_build deducing out_ms out_text)
+    set(binary "${OUT_DIR}/many_results_deducing_${deducing}")
+    set(best "")
+    foreach(run RANGE 1 3)
+        string(TIMESTAMP begin "%s%f")
+        execute_process(
+            COMMAND "${CXX}" -std=c++23 -O2 "-I${INCLUDE_DIR}" "-DFEER_DEDUCING_THIS=${deducing}" "${SOURCE}" -o "${binary}"
+            RESULT_VARIABLE status
+        )
+        string(TIMESTAMP end "%s%f")
+        if(NOT status EQUAL 0)
+            message(FATAL_ERROR "compilation with FEER_DEDUCING_THIS=${deducing} failed; deducing this needs GCC 14, Clang 19 or MSVC 17.2")
+        endif()
+        math(EXPR elapsed "(${end} - ${begin}) / 1000")
+        if(best STREQUAL "" OR elapsed LESS best)
+            set(best ${elapsed})
+        endif()
+    endforeach()
+    feer_text_size("${binary}" text)
+    set(${out_ms} ${best} PARENT_SCOPE)
+    set(${out_text} ${text} PARENT_SCOPE)
+endfunction()
+
+feer_timed_build(0 overloads_ms overloads_text)
+feer_timed_build(1 deducing_ms deducing_text)
+
+message(STATUS "200 Result<T> instantiations, C++23, -O2:")
+message(STATUS "  ref-qualified overloads:  ${overloads_ms} ms, .text ${overloads_text} bytes")
+message(STATUS "  deducing this:            ${deducing_ms} ms, .text ${deducing_text} bytes")
@@ -0,0 +1,110 @@
+// Instantiates Result<T> for 200 distinct T and exercises every special member and accessor,
+// so the error-state code of each instantiation ends up in .text. Built twice by CMake: with
+// feer::Result and, with FEER_SIZE_BASELINE=1, with the storage Result used before
+// detail::ResultStorage: a std::variant<T, Err> with the same hooks.
+
+#include <feer/result.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <utility>
+#include <variant>
+
+#if !defined(FEER_SIZE_BASELINE)
+#define FEER_SIZE_BASELINE 0
+#endif
+
+namespace {
+
+template <std::size_t N>
+struct Payload {
+    std::uint64_t words[N % 4 + 1];
+    std::string label;
+};
+
+#if FEER_SIZE_BASELINE
+template <typename T>
+class VariantResult {
+public:
+    VariantResult(T&& value) : m_state(std::move(value)) {}
+
+    VariantResult(feer::Err&& err) : m_state(std::move(err)) {
+        feer::detail::err_propagated(std::get<feer::Err>(m_state));
+    }
+
+    [[nodiscard]] bool is_ok() const noexcept { return std::holds_alternative<T>(m_state); }
+
+    [[nodiscard]] T& value() & { return std::get<T>(m_state); }
+
+    [[nodiscard]] T value_or(T&& default_value) && {
+        if (is_ok()) {
+            return std::get<T>(std::move(m_state));
+        }
+        feer::detail::err_handled(std::get<feer::Err>(m_state));
+        return std::move(default_value);
+    }
+
+    template <typename OkFn, typename ErrFn>
+    [[nodiscard]] auto match(OkFn&& on_ok, ErrFn&& on_err) const& {
+        if (is_ok()) {
+            return std::invoke(std::forward<OkFn>(on_ok), std::get<T>(m_state));
+        }
+        feer::detail::err_handled(std::get<feer::Err>(m_state));
+        return std::invoke(std::forward<ErrFn>(on_err), std::get<feer::Err>(m_state));
+    }
+
+private:
+    std::variant<T, feer::Err> m_state;
+};
+
+template <typename T>
+using SizedResult = VariantResult<T>;
+#else
+template <typename T>
+using SizedResult = feer::Result<T>;
+#endif
+
+volatile std::uint64_t sink = 0;
+
+template <std::size_t N>
+[[gnu::noinline]] SizedResult<Payload<N>> make(bool fail) {
+    if (fail) {
+        return feer::Err{"payload " + std::to_string(N) + " unavailable"};
+    }
+    return Payload<N>{{N}, "payload"};
+}
+
+template <std::size_t N>
+[[gnu::noinline]] void exercise(bool fail) {
+    SizedResult<Payload<N>> result = make<N>(fail);
+    SizedResult<Payload<N>> copy = result;
+    SizedResult<Payload<N>> moved = std::move(copy);
+    copy = moved;
+    moved = make<N>(!fail);
+
+    sink = sink + result.match(
+                      [](const Payload<N>& payload) { return payload.words[0]; },
+                      [](const feer::Err& err) { return static_cast<std::uint64_t>(err.message.size()); });
+    sink = sink + std::move(moved).value_or(Payload<N>{{0}, {}}).words[0];
+    try {
+        sink = sink + copy.value().words[0];
+    } catch (const std::bad_variant_access&) {
+        sink = sink + 1;
+    }
+}
+
+template <std::size_t... N>
+void exercise_all(bool fail, std::index_sequence<N...>) {
+    (exercise<N>(fail), ...);
+}
+
+}  // namespace
+
+int main(int argc, char**) {
+    exercise_all(argc > 1, std::make_index_sequence<200>{});
+    std::printf("%llu\n", static_cast<unsigned long long>(sink));
+    return 0;
+}
@@ -0,0 +1,10 @@
+# feer_text_size(<binary> <out_var>): size in bytes of the .text section of binary, read with SIZE_TOOL.
+
+function(feer_text_size binary out_var)
+    execute_process(COMMAND "${SIZE_TOOL}" -A "${binary}" OUTPUT_VARIABLE sections RESULT_VARIABLE status)
+    if(NOT status EQUAL 0)
+        message(FATAL_ERROR "${SIZE_TOOL} failed on ${binary}")
+    endif()
+    string(REGEX MATCH "\n\\.text[ \t]+([0-9]+)" _ "${sections}")
+    set(${out_var} "${CMAKE_MATCH_1}" PARENT_SCOPE)
+endfunction()
@@ -0,0 +1,13 @@
+# Prints the .text size of many_results.cpp built with feer::Result and with the std::variant<T, Err>
+# storage it replaced. Invoked by the feer_size_report target with SIZE_TOOL, RESULT and BASELINE set.
+
+include(${CMAKE_CURRENT_LIST_DIR}/text_size.cmake)
+
+feer_text_size("${BASELINE}" baseline_text)
+feer_text_size("${RESULT}" result_text)
+math(EXPR saved "${baseline_text} - ${result_text}")
+
+message(STATUS "200 Result<T> instantiations, .text bytes:")
+message(STATUS "  std::variant<T, Err> storage (FEER_SIZE_BASELINE=1): ${baseline_text}")
+message(STATUS "  feer::Result (detail::ResultStorage):                ${result_text}")
+message(STATUS "  saved (negative: grown):                             ${saved}")
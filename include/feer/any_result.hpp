@@ -0,0 +1,261 @@
+#pragma once
+
+#include <feer/result.hpp>
+#include <feer/type_id.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace feer {
+
+class AnyResult;
+
+namespace detail {
+
+struct AnyResultStorage {
+    alignas(std::max_align_t) unsigned char bytes[64];
+};
+
+/** Hand-rolled vtable of one stored Result<T>, one instance per T (per shared library). */
+struct AnyResultVTable {
+    std::uint64_t type;
+    std::string_view type_name;
+    std::uint64_t result_type;
+    std::string_view result_type_name;
+    void (*relocate)(AnyResultStorage& from, AnyResultStorage& to) noexcept;
+    void (*destroy)(AnyResultStorage& storage) noexcept;
+    bool (*is_ok)(const AnyResultStorage& storage) noexcept;
+    const Err& (*error)(const AnyResultStorage& storage);
+};
+
+template <typename R>
+inline constexpr bool any_result_inline = sizeof(R) <= sizeof(AnyResultStorage) &&
+                                          alignof(R) <= alignof(AnyResultStorage) &&
+                                          std::is_nothrow_move_constructible_v<R>;
+
+template <typename R>
+struct AnyResultOps {
+    static R& get(AnyResultStorage& storage) noexcept {
+        if constexpr (any_result_inline<R>) {
+            return *std::launder(reinterpret_cast<R*>(storage.bytes));
+        } else {
+            return **std::launder(reinterpret_cast<R**>(storage.bytes));
+        }
+    }
+
+    static const R& get(const AnyResultStorage& storage) noexcept {
+        return get(const_cast<AnyResultStorage&>(storage));
+    }
+
+    static void relocate(AnyResultStorage& from, AnyResultStorage& to) noexcept {
+        if constexpr (any_result_inline<R>) {
+            ::new (static_cast<void*>(to.bytes)) R(FEER_MOVE(get(from)));
+            std::destroy_at(std::addressof(get(from)));
+        } else {
+            ::new (static_cast<void*>(to.bytes)) R*(std::addressof(get(from)));
+        }
+    }
+
+    static void destroy(AnyResultStorage& storage) noexcept {
+        if constexpr (any_result_inline<R>) {
+            std::destroy_at(std::addressof(get(storage)));
+        } else {
+            delete std::addressof(get(storage));
+        }
+    }
+
+    static bool is_ok(const AnyResultStorage& storage) noexcept { return get(storage).is_ok(); }
+
+    static const Err& error(const AnyResultStorage& storage) { return get(storage).error(); }
+};
+
+template <typename T>
+inline constexpr AnyResultVTable any_result_vtable{
+    feer::type_id<T>,
+    feer::type_name<T>,
+    feer::type_id<Result<T>>,
+    feer::type_name<Result<T>>,
+    &AnyResultOps<Result<T>>::relocate,
+    &AnyResultOps<Result<T>>::destroy,
+    &AnyResultOps<Result<T>>::is_ok,
+    &AnyResultOps<Result<T>>::error,
+};
+
+/**
+ * True when vtable describes Result<T>. The same T has one table per shared library when
+ * inline variables are not merged (Windows DLLs, ELF objects built with hidden visibility),
+ * so differing addresses fall back to the id and name of Result<T>, which keep cv-qualifiers.
+ */
+template <typename T>
+[[nodiscard]] bool any_result_holds(const AnyResultVTable* vtable) noexcept {
+    if (vtable == &any_result_vtable<T>) {
+        return true;
+    }
+    return vtable != nullptr && vtable->result_type == feer::type_id<Result<T>> &&
+           vtable->result_type_name == feer::type_name<Result<T>>;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Holds a Result<T> of any T, for heterogeneous pipelines.
+ *
+ * Results up to 64 bytes that are nothrow movable are stored inline, without allocation; that
+ * covers Result<T> for scalars, pointers, std::string and most small structs. Larger ones are
+ * moved to the heap. Dispatch goes through a static table of function pointers per T and the
+ * stored type is checked by comparing table addresses, so no RTTI is needed. A Result created in
+ * another shared library may use its own copy of the table; then the type ids and names are
+ * compared instead, so there types named alike in different anonymous namespaces would match.
+ * Move-only.
+ *
+ * @code
+ * std::vector<feer::AnyResult> outputs;
+ * outputs.emplace_back(feer::Result<int>{42});
+ * outputs.emplace_back(feer::Result<std::string>{feer::Err{"plugin failed"}});
+ *
+ * if (feer::Result<int>* count = outputs[0].downcast<int>()) {
+ *     use(count->value());
+ * }
+ * @endcode
+ */
+class AnyResult {
+public:
+    /** Capacity of the inline buffer in bytes. */
+    static constexpr std::size_t inline_capacity = sizeof(detail::AnyResultStorage);
+
+    /** Holds nothing. */
+    constexpr AnyResult() noexcept = default;
+
+    /** Holds result. */
+    template <typename T>
+    AnyResult(Result<T>&& result) : m_vtable(&detail::any_result_vtable<T>) {
+        if constexpr (detail::any_result_inline<Result<T>>) {
+            ::new (static_cast<void*>(m_storage.bytes)) Result<T>(FEER_MOVE(result));
+        } else {
+            ::new (static_cast<void*>(m_storage.bytes)) Result<T>*(new Result<T>(FEER_MOVE(result)));
+        }
+    }
+
+    AnyResult(AnyResult&& other) noexcept : m_vtable(other.m_vtable) {
+        if (m_vtable != nullptr) {
+            m_vtable->relocate(other.m_storage, m_storage);
+            other.m_vtable = nullptr;
+        }
+    }
+
+    AnyResult& operator=(AnyResult&& other) noexcept {
+        if (this != &other) {
+            reset();
+            if (other.m_vtable != nullptr) {
+                other.m_vtable->relocate(other.m_storage, m_storage);
+                m_vtable = std::exchange(other.m_vtable, nullptr);
+            }
+        }
+        return *this;
+    }
+
+    AnyResult(const AnyResult&) = delete;
+    AnyResult& operator=(const AnyResult&) = delete;
+
+    ~AnyResult() { reset(); }
+
+    /** @brief True when a Result is held. */
+    [[nodiscard]] bool has_value() const noexcept { return m_vtable != nullptr; }
+
+    /** @brief Destroys the held Result, if any. */
+    void reset() noexcept {
+        if (m_vtable != nullptr) {
+            m_vtable->destroy(m_storage);
+            m_vtable = nullptr;
+        }
+    }
+
+    /** @brief type_id of the held Result's T, or 0 when empty. */
+    [[nodiscard]] std::uint64_t type() const noexcept { return m_vtable != nullptr ? m_vtable->type : 0; }
+
+    /** @brief type_name of the held Result's T, or empty when empty. */
+    [[nodiscard]] std::string_view type_name() const noexcept {
+        return m_vtable != nullptr ? m_vtable->type_name : std::string_view{};
+    }
+
+    /** @brief True when a Result<T> is held. */
+    template <typename T>
+    [[nodiscard]] bool holds() const noexcept {
+        return detail::any_result_holds<T>(m_vtable);
+    }
+
+    /**
+     * @brief True when the held Result is in success state.
+     * @throws std::bad_variant_access if empty.
+     */
+    [[nodiscard]] bool is_ok() const {
+        check_not_empty();
+        return m_vtable->is_ok(m_storage);
+    }
+
+    /**
+     * @brief True when the held Result is in error state.
+     * @throws std::bad_variant_access if empty.
+     */
+    [[nodiscard]] bool is_err() const { return !is_ok(); }
+
+    /**
+     * @brief Error of the held Result, whatever its T.
+     * @throws std::bad_variant_access if empty or in success state.
+     */
+    [[nodiscard]] const Err& error() const {
+        check_not_empty();
+        return m_vtable->error(m_storage);
+    }
+
+    /** @brief The held Result<T>, or nullptr when empty or holding another T. */
+    template <typename T>
+    [[nodiscard]] Result<T>* downcast() noexcept {
+        if (!holds<T>()) {
+            return nullptr;
+        }
+        return std::addressof(detail::AnyResultOps<Result<T>>::get(m_storage));
+    }
+
+    /** @brief The held Result<T>, or nullptr when empty or holding another T. */
+    template <typename T>
+    [[nodiscard]] const Result<T>* downcast() const noexcept {
+        return const_cast<AnyResult*>(this)->downcast<T>();
+    }
+
+    /**
+     * @brief Moves the held Result<T> out and leaves this empty.
+     * @return The Result, or an Err naming both types when empty or holding another T.
+     */
+    template <typename T>
+    [[nodiscard]] Result<T> take(const std::source_location& where = std::source_location::current()) {
+        Result<T>* held = downcast<T>();
+        if (held == nullptr) [[unlikely]] {
+            return Err{
+                "AnyResult holds " + std::string{m_vtable != nullptr ? type_name() : "nothing"} + ", not " +
+                    std::string{feer::type_name<T>},
+                where};
+        }
+        Result<T> out = FEER_MOVE(*held);
+        reset();
+        return out;
+    }
+
+private:
+    void check_not_empty() const {
+        if (m_vtable == nullptr) [[unlikely]] {
+            detail::ErrOps::bad_access();
+        }
+    }
+
+    const detail::AnyResultVTable* m_vtable = nullptr;
+    detail::AnyResultStorage m_storage;
+};
+
+}  // namespace feer
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace feer {
+
+namespace detail {
+
+/** Fixed-size copy of an error message, usable as a template argument. */
+template <std::size_t Size>
+struct CompileTimeMessage {
+    consteval explicit CompileTimeMessage(std::string_view in_text) {
+        for (std::size_t i = 0; i < Size; ++i) {
+            text[i] = in_text[i];
+        }
+    }
+
+    char text[Size + 1]{};
+};
+
+/** "file:line: message" of err. */
+constexpr std::string describe(const Err& err) {
+    std::string line_text;
+    for (std::uint_least32_t line = err.where.line(); line != 0 || line_text.empty(); line /= 10) {
+        line_text.insert(line_text.begin(), static_cast<char>('0' + line % 10));
+    }
+    return std::string{err.where.file_name()} + ":" + line_text + ": " + err.message;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Never defined. Naming it with an error message turns that message into a compile error.
+ *
+ * compile_time_value reports a failed Result by requiring this type to be complete, so the
+ * compiler prints the message as part of the template argument:
+ * @code
+ * error: invalid use of incomplete type 'struct feer::compile_time_err<...{"config.hpp:12: port out of range"}>'
+ * @endcode
+ */
+template <detail::CompileTimeMessage Message>
+struct compile_time_err;
+
+/**
+ * @brief Evaluates Fn() at compile time and returns its success value.
+ *
+ * Fn is a captureless lambda (or any constexpr callable object) returning a Result. When the
+ * Result holds an error, compilation fails with the error's location and message. For
+ * Result<void> only the check is performed.
+ *
+ * @code
+ * constexpr std::uint16_t port = feer::compile_time_value<[] { return parse_port("8080"); }>();
+ * @endcode
+ */
+template <auto Fn>
+consteval auto compile_time_value() {
+    using result_type = std::remove_cvref_t<decltype(Fn())>;
+
+    if constexpr (constexpr bool ok = Fn().is_ok(); !ok) {
+        constexpr std::size_t size = detail::describe(Fn().error()).size();
+        constexpr detail::CompileTimeMessage<size> message{detail::describe(Fn().error())};
+        static_cast<void>(sizeof(compile_time_err<message>));
+    } else if constexpr (!std::is_same_v<result_type, Result<void>>) {
+        return Fn().value();
+    }
+}
+
+}  // namespace feer
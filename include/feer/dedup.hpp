@@ -0,0 +1,171 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+namespace feer {
+
+/**
+ * @brief Outcome of feeding one error occurrence to a Deduplicator.
+ */
+struct DedupVerdict {
+    /** True when the caller should log this occurrence. */
+    bool emit;
+
+    /** Occurrences collapsed since the previous emitted one (only meaningful when emit is true). */
+    std::uint64_t suppressed;
+};
+
+/**
+ * @brief Collapses repeated errors within a time window.
+ *
+ * Errors are keyed by Err::fingerprint(), i.e. by construction site; pass a feer::fingerprint of
+ * site and message template to tell apart several kinds of errors raised at one site. The first
+ * occurrence of a fingerprint in a window is emitted, the rest are counted. The first occurrence
+ * after the window ends is emitted again and carries the number of occurrences that were
+ * collapsed, so callers can log "N occurrences".
+ *
+ * Backed by a fixed-size open-addressing table of atomics: observe() never locks or allocates.
+ * A slot whose window has ended and has no pending count is reused for a new fingerprint, so the
+ * table only fills up with more than Capacity fingerprints active in one window; observe() then
+ * fails open and emits every occurrence. Reuse races with a concurrent occurrence of the evicted
+ * fingerprint at worst emit one extra line or collapse one that should have been emitted.
+ *
+ * @tparam Capacity Number of fingerprints tracked at once. Must be a power of two.
+ *
+ * @code
+ * feer::Deduplicator<> dedup{std::chrono::seconds{10}};
+ *
+ * if (auto verdict = dedup.observe(err); verdict.emit) {
+ *     log("{} (+{} occurrences)", err.message, verdict.suppressed);
+ * }
+ * @endcode
+ */
+template <std::size_t Capacity = 1024>
+class Deduplicator {
+
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Deduplicator: Capacity must be a power of two");
+
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Constructs a Deduplicator.
+     * @param window Length of the collapsing window.
+     */
+    explicit Deduplicator(clock::duration window) noexcept
+        : m_window(std::chrono::duration_cast<std::chrono::nanoseconds>(window).count()) {}
+
+    Deduplicator(const Deduplicator&) = delete;
+    Deduplicator& operator=(const Deduplicator&) = delete;
+
+    /**
+     * @brief Records one occurrence of err.
+     * @param now Observation time.
+     */
+    [[nodiscard]] DedupVerdict observe(const Err& err, clock::time_point now = clock::now()) noexcept {
+        return observe(err.fingerprint(), now);
+    }
+
+    /**
+     * @brief Records one occurrence of the error identified by fingerprint.
+     * @param now Observation time.
+     */
+    [[nodiscard]] DedupVerdict observe(std::uint64_t fingerprint, clock::time_point now = clock::now()) noexcept {
+        const std::int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+
+        Slot* slot = find_or_claim(fingerprint != 0 ? fingerprint : 1, now_ns);
+        if (slot == nullptr) {
+            return {true, 0};
+        }
+
+        std::int64_t start = slot->window_start.load(std::memory_order_acquire);
+        for (;;) {
+            if (start != unset && now_ns - start < m_window) {
+                slot->suppressed.fetch_add(1, std::memory_order_relaxed);
+                return {false, 0};
+            }
+            if (slot->window_start.compare_exchange_weak(start, now_ns, std::memory_order_acq_rel)) {
+                return {true, slot->suppressed.exchange(0, std::memory_order_relaxed)};
+            }
+        }
+    }
+
+    /**
+     * @brief Reports and resets pending suppressed counts.
+     * @param fn Called as fn(std::uint64_t fingerprint, std::uint64_t suppressed) for every
+     *           fingerprint with suppressed occurrences in its current window.
+     */
+    template <typename Fn>
+    void drain(Fn&& fn) {
+        for (Slot& slot : m_slots) {
+            const std::uint64_t key = slot.key.load(std::memory_order_acquire);
+            if (key == 0) {
+                continue;
+            }
+            if (const std::uint64_t count = slot.suppressed.exchange(0, std::memory_order_relaxed); count != 0) {
+                std::invoke(fn, key, count);
+            }
+        }
+    }
+
+private:
+    static constexpr std::int64_t unset = std::numeric_limits<std::int64_t>::min();
+
+    struct Slot {
+        std::atomic<std::uint64_t> key{0};
+        std::atomic<std::int64_t> window_start{unset};
+        std::atomic<std::uint64_t> suppressed{0};
+    };
+
+    bool expired(const Slot& slot, std::int64_t now_ns) const noexcept {
+        const std::int64_t start = slot.window_start.load(std::memory_order_acquire);
+        return start != unset && now_ns - start >= m_window && slot.suppressed.load(std::memory_order_relaxed) == 0;
+    }
+
+    // Looks key up along its whole probe sequence before claiming, so reusing an expired slot
+    // never creates a second slot for a key that sits further along.
+    Slot* find_or_claim(std::uint64_t key, std::int64_t now_ns) noexcept {
+        Slot* reusable = nullptr;
+        std::size_t index = static_cast<std::size_t>(key) & (Capacity - 1);
+        for (std::size_t probe = 0; probe < Capacity; ++probe, index = (index + 1) & (Capacity - 1)) {
+            Slot& slot = m_slots[index];
+            std::uint64_t current = slot.key.load(std::memory_order_acquire);
+            if (current == key) {
+                return &slot;
+            }
+            if (current == 0) {
+                if (reusable != nullptr && claim(*reusable, key, now_ns)) {
+                    return reusable;
+                }
+                if (slot.key.compare_exchange_strong(current, key, std::memory_order_acq_rel) || current == key) {
+                    return &slot;
+                }
+                continue;
+            }
+            if (reusable == nullptr && expired(slot, now_ns)) {
+                reusable = &slot;
+            }
+        }
+        return reusable != nullptr && claim(*reusable, key, now_ns) ? reusable : nullptr;
+    }
+
+    // The slot keeps its expired window_start, so the new key's first occurrence is emitted.
+    bool claim(Slot& slot, std::uint64_t key, std::int64_t now_ns) noexcept {
+        std::uint64_t current = slot.key.load(std::memory_order_acquire);
+        return current != 0 && expired(slot, now_ns) &&
+               slot.key.compare_exchange_strong(current, key, std::memory_order_acq_rel);
+    }
+
+    std::int64_t m_window;
+    std::array<Slot, Capacity> m_slots{};
+};
+
+}  // namespace feer
@@ -0,0 +1,665 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace feer {
+
+/**
+ * @brief Closed list of error types a Result may hold, checked at compile time.
+ *
+ * Types must be distinct, non-const, non-reference object types. At most 255 types.
+ */
+template <typename... Es>
+struct ErrorSet {
+    static constexpr std::size_t size = sizeof...(Es);
+
+    /** True when E is one of the types of this set. */
+    template <typename E>
+    static constexpr bool contains = (std::is_same_v<E, Es> || ...);
+};
+
+template <typename Set>
+class SetError;
+
+namespace detail {
+
+template <typename E, typename... Es>
+consteval std::size_t index_in() {
+    constexpr bool matches[] = {std::is_same_v<E, Es>..., false};
+    std::size_t index = 0;
+    while (index < sizeof...(Es) && !matches[index]) {
+        ++index;
+    }
+    return index;
+}
+
+template <typename Set, typename... Es>
+struct set_append;
+
+template <typename... Out>
+struct set_append<ErrorSet<Out...>> {
+    using type = ErrorSet<Out...>;
+};
+
+template <typename... Out, typename E, typename... Rest>
+struct set_append<ErrorSet<Out...>, E, Rest...>
+    : set_append<std::conditional_t<ErrorSet<Out...>::template contains<E>, ErrorSet<Out...>, ErrorSet<Out..., E>>,
+                 Rest...> {};
+
+template <typename Acc, typename... Sets>
+struct set_union {
+    using type = Acc;
+};
+
+template <typename Acc, typename... Es, typename... Sets>
+struct set_union<Acc, ErrorSet<Es...>, Sets...> : set_union<typename set_append<Acc, Es...>::type, Sets...> {};
+
+template <typename Sub, typename Super>
+inline constexpr bool is_subset_of = false;
+
+template <typename... Fs, typename Super>
+inline constexpr bool is_subset_of<ErrorSet<Fs...>, Super> = (Super::template contains<Fs> && ...);
+
+/** Recursive union of Ts; the active member is tracked by TaggedUnion. */
+template <typename... Ts>
+union UnionStorage;
+
+template <>
+union UnionStorage<> {};
+
+template <typename Head, typename... Tail>
+union UnionStorage<Head, Tail...> {
+    constexpr UnionStorage() noexcept : tail() {}
+
+    constexpr UnionStorage(const UnionStorage&) = default;
+    constexpr UnionStorage(UnionStorage&&) = default;
+    constexpr UnionStorage& operator=(const UnionStorage&) = default;
+    constexpr UnionStorage& operator=(UnionStorage&&) = default;
+
+    constexpr ~UnionStorage() requires(std::is_trivially_destructible_v<Head> &&
+                                       (std::is_trivially_destructible_v<Tail> && ...)) = default;
+    constexpr ~UnionStorage() {}
+
+    Head head;
+    UnionStorage<Tail...> tail;
+};
+
+template <std::size_t I, typename Storage>
+FEER_ALWAYS_INLINE constexpr auto& union_get(Storage& storage) noexcept {
+    if constexpr (I == 0) {
+        return storage.head;
+    } else {
+        return detail::union_get<I - 1>(storage.tail);
+    }
+}
+
+template <std::size_t I, typename Storage, typename... Args>
+FEER_ALWAYS_INLINE constexpr void union_construct(Storage& storage, Args&&... args) {
+    if constexpr (I == 0) {
+        std::construct_at(std::addressof(storage.head), FEER_FORWARD(args)...);
+    } else {
+        std::construct_at(std::addressof(storage.tail));
+        detail::union_construct<I - 1>(storage.tail, FEER_FORWARD(args)...);
+    }
+}
+
+/** Calls fn(std::integral_constant<std::size_t, index>) for a runtime index below Count. */
+template <std::size_t Count, std::size_t I = 0, typename Fn>
+FEER_ALWAYS_INLINE constexpr decltype(auto) visit_index(std::size_t index, Fn&& fn) {
+    if constexpr (I + 1 == Count) {
+        return fn(std::integral_constant<std::size_t, I>{});
+    } else {
+        if (index == I) {
+            return fn(std::integral_constant<std::size_t, I>{});
+        }
+        return detail::visit_index<Count, I + 1>(index, FEER_FORWARD(fn));
+    }
+}
+
+/**
+ * Compact variant: the largest of Ts plus a one-byte index.
+ *
+ * Trivially copyable when every T is, so small instances are returned in registers.
+ */
+template <typename... Ts>
+class TaggedUnion {
+    static_assert(sizeof...(Ts) <= 255, "TaggedUnion: at most 255 alternatives");
+
+    static constexpr bool trivial = (std::is_trivially_copyable_v<Ts> && ...);
+    static constexpr bool copyable = (std::is_copy_constructible_v<Ts> && ...);
+
+public:
+    template <std::size_t I, typename... Args>
+    FEER_ALWAYS_INLINE constexpr explicit TaggedUnion(std::in_place_index_t<I>, Args&&... args)
+        : m_index(static_cast<std::uint8_t>(I)) {
+        detail::union_construct<I>(m_storage, FEER_FORWARD(args)...);
+    }
+
+    constexpr TaggedUnion(const TaggedUnion&) requires(trivial) = default;
+    constexpr TaggedUnion(TaggedUnion&&) requires(trivial) = default;
+    constexpr TaggedUnion& operator=(const TaggedUnion&) requires(trivial) = default;
+    constexpr TaggedUnion& operator=(TaggedUnion&&) requires(trivial) = default;
+    constexpr ~TaggedUnion() requires(trivial) = default;
+
+    constexpr TaggedUnion(const TaggedUnion& other) requires(!trivial && copyable) : m_index(other.m_index) {
+        other.visit([&](auto i) { detail::union_construct<i>(m_storage, other.template get<i>()); });
+    }
+
+    constexpr TaggedUnion(TaggedUnion&& other) noexcept((std::is_nothrow_move_constructible_v<Ts> && ...))
+        requires(!trivial)
+        : m_index(other.m_index) {
+        other.visit([&](auto i) { detail::union_construct<i>(m_storage, FEER_MOVE(other).template get<i>()); });
+    }
+
+    constexpr TaggedUnion& operator=(const TaggedUnion& other) requires(!trivial && copyable) {
+        if (this != &other) {
+            *this = TaggedUnion{other};
+        }
+        return *this;
+    }
+
+    constexpr TaggedUnion& operator=(TaggedUnion&& other) noexcept(
+        (std::is_nothrow_move_constructible_v<Ts> && ...) && (std::is_nothrow_move_assignable_v<Ts> && ...))
+        requires(!trivial)
+    {
+        if (this == &other) {
+            return *this;
+        }
+        if (m_index == other.m_index) {
+            visit([&](auto i) { get<i>() = FEER_MOVE(other).template get<i>(); });
+        } else {
+            other.visit([&](auto i) { replace_with<i>(FEER_MOVE(other).template get<i>()); });
+        }
+        return *this;
+    }
+
+    constexpr ~TaggedUnion() requires(!trivial) { destroy(); }
+
+    /** Index of the active alternative. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr std::size_t index() const noexcept { return m_index; }
+
+    template <std::size_t I>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto& get() & noexcept {
+        return detail::union_get<I>(m_storage);
+    }
+
+    template <std::size_t I>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr const auto& get() const& noexcept {
+        return detail::union_get<I>(m_storage);
+    }
+
+    template <std::size_t I>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto&& get() && noexcept {
+        return FEER_MOVE(detail::union_get<I>(m_storage));
+    }
+
+    /** Calls fn(std::integral_constant<std::size_t, index()>). */
+    template <typename Fn>
+    FEER_ALWAYS_INLINE constexpr decltype(auto) visit(Fn&& fn) const {
+        return detail::visit_index<sizeof...(Ts)>(m_index, FEER_FORWARD(fn));
+    }
+
+private:
+    constexpr void destroy() noexcept {
+        visit([&](auto i) { std::destroy_at(std::addressof(get<i>())); });
+    }
+
+    // m_index must name a live alternative whenever the new one's constructor can throw, so the
+    // current one is moved aside first and moved back if construction fails.
+    template <std::size_t I, typename Arg>
+    constexpr void replace_with(Arg&& arg) {
+        using incoming = std::remove_cvref_t<decltype(get<I>())>;
+        if constexpr (std::is_nothrow_constructible_v<incoming, Arg>) {
+            destroy();
+            detail::union_construct<I>(m_storage, FEER_FORWARD(arg));
+        } else {
+            TaggedUnion saved{FEER_MOVE(*this)};
+            destroy();
+            try {
+                detail::union_construct<I>(m_storage, FEER_FORWARD(arg));
+            } catch (...) {
+                restore(FEER_MOVE(saved));
+                throw;
+            }
+        }
+        m_index = static_cast<std::uint8_t>(I);
+    }
+
+    // noexcept: if moving the saved alternative back throws as well, there is nothing left to hold
+    // and the program terminates.
+    constexpr void restore(TaggedUnion&& saved) noexcept {
+        saved.visit([&](auto i) { detail::union_construct<i>(m_storage, FEER_MOVE(saved).template get<i>()); });
+        m_index = saved.m_index;
+    }
+
+    UnionStorage<Ts...> m_storage;
+    std::uint8_t m_index;
+};
+
+template <typename... Fns>
+struct Overloaded : Fns... {
+    using Fns::operator()...;
+};
+
+template <typename E, bool Handled>
+struct require_error_handler {
+    static_assert(Handled, "match: no error handler accepts E; the handlers must cover every type of the ErrorSet");
+    static constexpr bool value = Handled;
+};
+
+template <typename... Es>
+consteval void check_error_set() {
+    static_assert(sizeof...(Es) > 0, "ErrorSet: the set must not be empty");
+    static_assert(sizeof...(Es) < 256, "ErrorSet: at most 255 error types");
+    static_assert(
+        ((std::is_object_v<Es> && !std::is_const_v<Es> && !std::is_volatile_v<Es>) && ...),
+        "ErrorSet: error types must be non-const, non-reference object types");
+    static_assert(
+        []<std::size_t... I>(std::index_sequence<I...>) {
+            return ((index_in<std::tuple_element_t<I, std::tuple<Es...>>, Es...>() == I) && ...);
+        }(std::index_sequence_for<Es...>{}),
+        "ErrorSet: error types must be distinct");
+}
+
+}  // namespace detail
+
+/**
+ * @brief ErrorSet holding every type of Sets, in order of first appearance.
+ *
+ * @code
+ * using LoadErrors = feer::error_set_union_t<ReadErrors, ParseErrors>;
+ * @endcode
+ */
+template <typename... Sets>
+using error_set_union_t = typename detail::set_union<ErrorSet<>, Sets...>::type;
+
+/**
+ * @brief One error of an ErrorSet, without a success value.
+ *
+ * Converts into any Result whose ErrorSet contains every type of Set, which is how errors are
+ * propagated to a caller with a wider set. Obtained from Result::errors().
+ */
+template <typename... Es>
+class SetError<ErrorSet<Es...>> {
+public:
+    using error_set = ErrorSet<Es...>;
+
+    /** Holds err. */
+    template <typename E>
+        requires(error_set::template contains<std::remove_cvref_t<E>>)
+    FEER_ALWAYS_INLINE constexpr SetError(E&& err)
+        : m_errors(std::in_place_index<detail::index_in<std::remove_cvref_t<E>, Es...>()>, FEER_FORWARD(err)) {}
+
+    /** Index of the held error in the set. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr std::size_t index() const noexcept { return m_errors.index(); }
+
+    /** True when the held error is an E. */
+    template <typename E>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool holds() const noexcept {
+        static_assert(error_set::template contains<E>, "SetError::holds: E is not in the ErrorSet");
+        return m_errors.index() == detail::index_in<E, Es...>();
+    }
+
+    /**
+     * @brief Returns the held E.
+     * @throws std::bad_variant_access if another error is held.
+     */
+    template <typename E>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr const E& get() const {
+        if (!holds<E>()) [[unlikely]] {
+            detail::ErrOps::bad_access();
+        }
+        return m_errors.template get<detail::index_in<E, Es...>()>();
+    }
+
+    /**
+     * @brief Calls the handler accepting the held error.
+     *
+     * Handlers are combined into one overload set that must accept every type of the set.
+     */
+    template <typename... ErrFns>
+    [[nodiscard]] constexpr decltype(auto) match(ErrFns&&... on_err) const {
+        using handlers_type = detail::Overloaded<std::decay_t<ErrFns>...>;
+        static_assert(
+            (detail::require_error_handler<Es, std::is_invocable_v<handlers_type&, const Es&>>::value && ...));
+
+        handlers_type handlers{FEER_FORWARD(on_err)...};
+        return m_errors.visit([&](auto i) -> decltype(auto) { return handlers(m_errors.template get<i>()); });
+    }
+
+private:
+    template <typename, typename, typename>
+    friend class BasicResult;
+
+    template <typename>
+    friend class SetError;
+
+    constexpr explicit SetError(detail::TaggedUnion<Es...>&& errors) : m_errors(FEER_MOVE(errors)) {}
+
+    detail::TaggedUnion<Es...> m_errors;
+};
+
+/**
+ * @brief Result holding success value `T` or exactly one error of `ErrorSet<Es...>`.
+ *
+ * Storage is a compact variant: the largest of T and Es plus a one-byte tag. When T and every error
+ * are trivially copyable, so is the Result. Errors of a narrower set convert implicitly, so a
+ * callee's errors propagate into any caller whose set contains them; see FEER_TRY.
+ *
+ * Error sets are independent of Err: error hooks, metrics and inspection checks do not apply.
+ *
+ * @code
+ * feer::Result<Config, feer::ErrorSet<IoError, ParseError>> load(const char* path) {
+ *     std::string text = FEER_TRY(read_file(path));   // ErrorSet<IoError>
+ *     return parse_config(text);                       // ErrorSet<ParseError>
+ * }
+ *
+ * load("app.conf").match(
+ *     [](const Config& config) { ... },
+ *     [](const IoError& err) { ... },
+ *     [](const ParseError& err) { ... });
+ * @endcode
+ */
+template <typename T, typename... Es>
+class BasicResult<T, ErrorSet<Es...>, DefaultPolicy> {
+    static_assert(
+        !std::is_rvalue_reference_v<T>,
+        "Result<T, ErrorSet>: rvalue reference types (T&&) are not supported");
+
+    static_assert((detail::check_error_set<Es...>(), true));
+
+    static_assert(
+        !ErrorSet<Es...>::template contains<std::remove_cvref_t<T>>,
+        "Result<T, ErrorSet>: T must not be one of the error types");
+
+public:
+    using value_type = std::remove_reference_t<T>;
+    using stored_type = std::conditional_t<
+        std::is_void_v<T>,
+        std::monostate,
+        std::conditional_t<std::is_reference_v<T>, std::reference_wrapper<value_type>, value_type>>;
+    using error_set = ErrorSet<Es...>;
+    using error_type = SetError<error_set>;
+
+private:
+    using object_type = std::conditional_t<std::is_void_v<T>, std::monostate, value_type>;
+    using storage_type = detail::TaggedUnion<stored_type, Es...>;
+
+public:
+    /** Construct success result for void. */
+    FEER_ALWAYS_INLINE constexpr BasicResult() requires(std::is_void_v<T>) : m_state(std::in_place_index<0>) {}
+
+    /** Construct success result from lvalue value (non-reference T). */
+    FEER_ALWAYS_INLINE constexpr BasicResult(const object_type& value) requires(!std::is_void_v<T> && !std::is_reference_v<T>)
+        : m_state(std::in_place_index<0>, value) {}
+
+    /** Construct success result from rvalue value (non-reference T). */
+    FEER_ALWAYS_INLINE constexpr BasicResult(object_type&& value) requires(!std::is_void_v<T> && !std::is_reference_v<T>)
+        : m_state(std::in_place_index<0>, FEER_MOVE(value)) {}
+
+    /** Construct success result from lvalue reference (reference T). */
+    FEER_ALWAYS_INLINE constexpr BasicResult(object_type& value) requires(std::is_reference_v<T>)
+        : m_state(std::in_place_index<0>, std::ref(value)) {}
+
+    /** Construct error result from any error of the set. */
+    template <typename E>
+        requires(error_set::template contains<std::remove_cvref_t<E>>)
+    FEER_ERR_COLD constexpr BasicResult(E&& err)
+        : m_state(std::in_place_index<detail::index_in<std::remove_cvref_t<E>, Es...>() + 1>, FEER_FORWARD(err)) {}
+
+    /** Construct error result from the errors of a Result whose set is contained in this one. */
+    template <typename... Fs>
+        requires(detail::is_subset_of<ErrorSet<Fs...>, error_set>)
+    FEER_ERR_COLD constexpr BasicResult(SetError<ErrorSet<Fs...>> errors) : m_state(widen(FEER_MOVE(errors.m_errors))) {}
+
+    /** @brief True when this object currently holds a success value. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool is_ok() const noexcept { return m_state.index() == 0; }
+
+    /** @brief True when this object currently holds an error. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool is_err() const noexcept { return m_state.index() != 0; }
+
+    /** @brief Convenience bool conversion. Equivalent to is_ok(). */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr explicit operator bool() const noexcept { return is_ok(); }
+
+    /**
+     * @brief Returns mutable success value.
+     * @throws std::bad_variant_access if current state is error.
+     */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto& value() & requires(!std::is_void_v<T>) {
+        check_ok();
+        return unwrap(m_state.template get<0>());
+    }
+
+    /**
+     * @brief Returns const success value.
+     * @throws std::bad_variant_access if current state is error.
+     */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr const auto& value() const& requires(!std::is_void_v<T>) {
+        check_ok();
+        return unwrap(m_state.template get<0>());
+    }
+
+    /**
+     * @brief Moves out success value (non-reference T).
+     * @throws std::bad_variant_access if current state is error.
+     */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto&& value() && requires(!std::is_void_v<T> && !std::is_reference_v<T>) {
+        check_ok();
+        return FEER_MOVE(m_state).template get<0>();
+    }
+
+    /**
+     * @brief Returns referenced object (reference T).
+     * @throws std::bad_variant_access if current state is error.
+     */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto& value() && requires(std::is_reference_v<T>) {
+        check_ok();
+        return m_state.template get<0>().get();
+    }
+
+    /**
+     * @brief Checks the success state of a void Result.
+     * @throws std::bad_variant_access if current state is error.
+     */
+    FEER_ALWAYS_INLINE constexpr void value() const requires(std::is_void_v<T>) { check_ok(); }
+
+    /**
+     * @brief Returns contained value or fallback if in error state.
+     * @param default_value Fallback value.
+     */
+    template <typename U>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr value_type value_or(U&& default_value) const&
+        requires(!std::is_void_v<T> && !std::is_reference_v<T>)
+    {
+        static_assert(std::is_convertible_v<U, value_type>, "value_or requires U convertible to T");
+        if (is_ok()) FEER_OK_BRANCH {
+            return m_state.template get<0>();
+        }
+        return static_cast<value_type>(FEER_FORWARD(default_value));
+    }
+
+    /**
+     * @brief Moves contained value out or returns fallback if in error state.
+     * @param default_value Fallback value.
+     */
+    template <typename U>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr value_type value_or(U&& default_value) &&
+        requires(!std::is_void_v<T> && !std::is_reference_v<T>)
+    {
+        static_assert(std::is_convertible_v<U, value_type>, "value_or requires U convertible to T");
+        if (is_ok()) FEER_OK_BRANCH {
+            return FEER_MOVE(m_state).template get<0>();
+        }
+        return static_cast<value_type>(FEER_FORWARD(default_value));
+    }
+
+    /** @brief True when this object currently holds an E. */
+    template <typename E>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool holds_error() const noexcept {
+        static_assert(error_set::template contains<E>, "holds_error: E is not in the ErrorSet");
+        return m_state.index() == detail::index_in<E, Es...>() + 1;
+    }
+
+    /**
+     * @brief Returns the held E.
+     * @throws std::bad_variant_access if no E is held.
+     */
+    template <typename E>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr const E& error() const& {
+        if (!holds_error<E>()) [[unlikely]] {
+            detail::ErrOps::bad_access();
+        }
+        return m_state.template get<detail::index_in<E, Es...>() + 1>();
+    }
+
+    /**
+     * @brief Returns a copy of the held error, for propagation or matching.
+     * @throws std::bad_variant_access if current state is success.
+     */
+    [[nodiscard]] constexpr error_type errors() const& {
+        check_err();
+        return error_type{narrow(m_state)};
+    }
+
+    /**
+     * @brief Moves the held error out, for propagation or matching.
+     * @throws std::bad_variant_access if current state is success.
+     */
+    [[nodiscard]] constexpr error_type errors() && {
+        check_err();
+        return error_type{narrow(FEER_MOVE(m_state))};
+    }
+
+    /**
+     * @brief Pattern match over success and every error of the set.
+     *
+     * The error handlers are combined into one overload set which must accept every type of the
+     * ErrorSet; a missing case is a compile error. A generic lambda covers all remaining cases.
+     *
+     * @param on_ok Called with const value (or nothing for void) when state is ok.
+     * @param on_err Handlers called with the const held error.
+     * @return Handler return value. All handlers must return the same type.
+     */
+    template <typename OkFn, typename... ErrFns>
+    [[nodiscard]] constexpr auto match(OkFn&& on_ok, ErrFns&&... on_err) const& {
+        return dispatch(*this, FEER_FORWARD(on_ok), FEER_FORWARD(on_err)...);
+    }
+
+    /**
+     * @brief Pattern match over rvalue success and every error of the set.
+     *
+     * Like the const& overload, but handlers receive the value and error as rvalues.
+     */
+    template <typename OkFn, typename... ErrFns>
+    [[nodiscard]] constexpr auto match(OkFn&& on_ok, ErrFns&&... on_err) && {
+        return dispatch(FEER_MOVE(*this), FEER_FORWARD(on_ok), FEER_FORWARD(on_err)...);
+    }
+
+private:
+    template <typename, typename, typename>
+    friend class BasicResult;
+
+    FEER_ALWAYS_INLINE constexpr explicit BasicResult(storage_type&& state) : m_state(FEER_MOVE(state)) {}
+
+    FEER_ALWAYS_INLINE constexpr void check_ok() const {
+        if (!is_ok()) [[unlikely]] {
+            detail::ErrOps::bad_access();
+        }
+    }
+
+    FEER_ALWAYS_INLINE constexpr void check_err() const {
+        if (is_ok()) [[unlikely]] {
+            detail::ErrOps::bad_access();
+        }
+    }
+
+    template <typename Stored>
+    FEER_ALWAYS_INLINE static constexpr auto& unwrap(Stored& stored) noexcept {
+        if constexpr (std::is_reference_v<T>) {
+            return stored.get();
+        } else {
+            return stored;
+        }
+    }
+
+    template <typename... Fs>
+    static constexpr storage_type widen(detail::TaggedUnion<Fs...>&& errors) {
+        return errors.visit([&](auto i) {
+            using error = std::tuple_element_t<i, std::tuple<Fs...>>;
+            return storage_type{
+                std::in_place_index<detail::index_in<error, Es...>() + 1>, FEER_MOVE(errors).template get<i>()};
+        });
+    }
+
+    template <typename State>
+    static constexpr detail::TaggedUnion<Es...> narrow(State&& state) {
+        return detail::visit_index<sizeof...(Es)>(state.index() - 1, [&](auto i) {
+            return detail::TaggedUnion<Es...>{std::in_place_index<i>, FEER_FORWARD(state).template get<i + 1>()};
+        });
+    }
+
+    template <typename Self, typename OkFn, typename... ErrFns>
+    static constexpr auto dispatch(Self&& self, OkFn&& on_ok, ErrFns&&... on_err) {
+        constexpr bool consume = !std::is_lvalue_reference_v<Self>;
+        using handlers_type = detail::Overloaded<std::decay_t<ErrFns>...>;
+        using ok_arg_type = std::conditional_t<
+            std::is_reference_v<T>,
+            object_type&,
+            std::conditional_t<consume, object_type&&, const object_type&>>;
+
+        static_assert(
+            (detail::require_error_handler<
+                 Es,
+                 std::is_invocable_v<handlers_type&, std::conditional_t<consume, Es&&, const Es&>>>::value &&
+             ...));
+
+        using ok_return_type = decltype([] {
+            if constexpr (std::is_void_v<T>) {
+                return std::type_identity<std::invoke_result_t<OkFn>>{};
+            } else {
+                return std::type_identity<std::invoke_result_t<OkFn, ok_arg_type>>{};
+            }
+        }())::type;
+
+        static_assert(
+            (std::is_same_v<
+                 ok_return_type,
+                 std::invoke_result_t<handlers_type&, std::conditional_t<consume, Es&&, const Es&>>> &&
+             ...),
+            "match requires all handlers to return the same type");
+
+        if (self.is_ok()) FEER_OK_BRANCH {
+            if constexpr (std::is_void_v<T>) {
+                return detail::invoke(FEER_FORWARD(on_ok));
+            } else if constexpr (std::is_reference_v<T>) {
+                return detail::invoke(FEER_FORWARD(on_ok), self.m_state.template get<0>().get());
+            } else if constexpr (consume) {
+                return detail::invoke(FEER_FORWARD(on_ok), FEER_MOVE(self.m_state).template get<0>());
+            } else {
+                return detail::invoke(FEER_FORWARD(on_ok), std::as_const(self.m_state.template get<0>()));
+            }
+        }
+
+        handlers_type handlers{FEER_FORWARD(on_err)...};
+        return detail::visit_index<sizeof...(Es)>(self.m_state.index() - 1, [&](auto i) -> ok_return_type {
+            if constexpr (consume) {
+                return handlers(FEER_MOVE(self.m_state).template get<i + 1>());
+            } else {
+                return handlers(std::as_const(self.m_state.template get<i + 1>()));
+            }
+        });
+    }
+
+    storage_type m_state;
+};
+
+}  // namespace feer
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <source_location>
+#include <type_traits>
+#include <variant>
+
+namespace feer {
+
+namespace detail {
+
+template <typename T, typename Policy>
+struct result_payload {
+    using storage_type = ResultStorage<typename BasicResult<T, Err, Policy>::stored_type, Policy>;
+    using type = typename storage_type::held_type;
+    static constexpr bool boxed = storage_type::boxed;
+};
+
+template <typename Policy>
+struct result_payload<void, Policy> {
+    using type = std::monostate;
+    static constexpr bool boxed = false;
+};
+
+}  // namespace detail
+
+template <typename R>
+struct result_layout;
+
+/**
+ * @brief Compile-time memory layout facts about a Result instantiation.
+ *
+ * Meant for pinning layouts in tests:
+ * @code
+ * static_assert(feer::result_layout<feer::Result<Packet>>::padding_bytes == 0);
+ * static_assert(feer::result_layout<feer::Result<Packet>>::size <= 64);
+ * @endcode
+ */
+template <typename T, typename Policy>
+struct result_layout<BasicResult<T, Err, Policy>> {
+    using result_type = BasicResult<T, Err, Policy>;
+    using payload_type = typename detail::result_payload<T, Policy>::type;
+
+    /** sizeof(Result<T>). */
+    static constexpr std::size_t size = sizeof(result_type);
+
+    /** alignof(Result<T>). */
+    static constexpr std::size_t align = alignof(result_type);
+
+    /** True when the success value is kept on the heap (see feer::box_value). */
+    static constexpr bool boxed = detail::result_payload<T, Policy>::boxed;
+
+    /** Bytes of the larger alternative (success payload, or the box pointer, or Err). */
+    static constexpr std::size_t payload_bytes = std::max(sizeof(payload_type), sizeof(Err));
+
+    /** Bytes of the discriminator. */
+    static constexpr std::size_t tag_bytes = 1;
+
+    /** Bytes added by debug instrumentation (FEER_CHECK_UNINSPECTED, FEER_AUDIT_COPIES). */
+    static constexpr std::size_t instrumentation_bytes =
+        (FEER_CHECK_UNINSPECTED ? 1 : 0) + (FEER_AUDIT_COPIES ? sizeof(std::source_location) : 0);
+
+    /** Bytes that carry no information. */
+    static constexpr std::size_t padding_bytes = size - payload_bytes - tag_bytes - instrumentation_bytes;
+
+    static constexpr bool trivially_copyable = std::is_trivially_copyable_v<result_type>;
+    static constexpr bool trivially_destructible = std::is_trivially_destructible_v<result_type>;
+    static constexpr bool nothrow_movable = std::is_nothrow_move_constructible_v<result_type>;
+
+    /**
+     * True when the SysV x86-64 ABI returns Result<T> in registers: at most 16 bytes and no
+     * non-trivial copy, move or destructor. Anything else is returned through a hidden pointer.
+     */
+    static constexpr bool sysv_register_returnable = size <= 16 && trivially_copyable && trivially_destructible;
+};
+
+}  // namespace feer
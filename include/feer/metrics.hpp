@@ -0,0 +1,327 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <source_location>
+#include <string_view>
+#include <vector>
+
+namespace feer {
+
+/**
+ * @brief HDR-style log-linear histogram of unsigned 64-bit values.
+ *
+ * Values below 4 are exact; above that every power of two is split into 4 sub-buckets, so a
+ * reported percentile is within 25% of the true value. Fixed 2 KiB footprint, no allocation.
+ *
+ * record() is single-writer: one thread records while any thread may read concurrently.
+ */
+class LogHistogram {
+public:
+    static constexpr unsigned sub_bucket_bits = 2;
+    static constexpr std::size_t sub_bucket_count = std::size_t{1} << sub_bucket_bits;
+    static constexpr std::size_t bucket_count = 64 * sub_bucket_count;
+
+    /** @brief Bucket holding value. */
+    [[nodiscard]] static constexpr std::size_t bucket_of(std::uint64_t value) noexcept {
+        if (value < sub_bucket_count) {
+            return static_cast<std::size_t>(value);
+        }
+        const unsigned msb = 63U - static_cast<unsigned>(std::countl_zero(value));
+        const unsigned shift = msb - sub_bucket_bits;
+        return (static_cast<std::size_t>(shift + 1) << sub_bucket_bits) +
+               static_cast<std::size_t>((value >> shift) & (sub_bucket_count - 1));
+    }
+
+    /** @brief Largest value mapping to bucket. */
+    [[nodiscard]] static constexpr std::uint64_t upper_bound_of(std::size_t bucket) noexcept {
+        if (bucket < sub_bucket_count) {
+            return bucket;
+        }
+        const unsigned shift = static_cast<unsigned>(bucket >> sub_bucket_bits) - 1;
+        const std::uint64_t sub = bucket & (sub_bucket_count - 1);
+        const std::uint64_t lower = (std::uint64_t{1} << (shift + sub_bucket_bits)) | (sub << shift);
+        return lower + ((std::uint64_t{1} << shift) - 1);
+    }
+
+    /** @brief Records one value. Must only be called by the owning thread. */
+    void record(std::uint64_t value) noexcept {
+        std::atomic_ref<std::uint64_t> bucket{m_buckets[bucket_of(value)]};
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /** @brief Adds all counts of other into this histogram. */
+    void merge(const LogHistogram& other) noexcept {
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            m_buckets[i] += other.bucket(i);
+        }
+    }
+
+    /** @brief Count recorded in bucket i. */
+    [[nodiscard]] std::uint64_t bucket(std::size_t i) const noexcept {
+        return std::atomic_ref<const std::uint64_t>{m_buckets[i]}.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Number of recorded values. */
+    [[nodiscard]] std::uint64_t count() const noexcept {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            total += bucket(i);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Upper bound of the bucket holding the q-th quantile.
+     * @param q Quantile in [0, 1].
+     * @return 0 when empty.
+     */
+    [[nodiscard]] std::uint64_t percentile(double q) const noexcept {
+        const std::uint64_t total = count();
+        if (total == 0) {
+            return 0;
+        }
+        const auto rank = static_cast<std::uint64_t>(std::clamp(q, 0.0, 1.0) * static_cast<double>(total - 1)) + 1;
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            seen += bucket(i);
+            if (seen >= rank) {
+                return upper_bound_of(i);
+            }
+        }
+        return upper_bound_of(bucket_count - 1);
+    }
+
+    /** @brief Upper bound of the highest non-empty bucket, or 0 when empty. */
+    [[nodiscard]] std::uint64_t max() const noexcept {
+        for (std::size_t i = bucket_count; i > 0; --i) {
+            if (bucket(i - 1) != 0) {
+                return upper_bound_of(i - 1);
+            }
+        }
+        return 0;
+    }
+
+private:
+    alignas(std::atomic_ref<std::uint64_t>::required_alignment) std::array<std::uint64_t, bucket_count> m_buckets{};
+};
+
+/**
+ * @brief Aggregated propagation metrics of one error construction site.
+ */
+struct PropagationSiteMetrics {
+    /** Construction site of the errors. */
+    std::source_location where;
+
+    /**
+     * Times an error was placed into a Result or moved into a new one before being handled. Moves
+     * that only relocate a Result (vector growth, AnyResult, PaddedResultArray::compact) count too.
+     */
+    LogHistogram hops;
+
+    /** Creation-to-handling latency in timestamp counter ticks; errors built at compile time are not sampled. */
+    LogHistogram latency_ticks;
+};
+
+namespace detail {
+
+inline constexpr std::size_t propagation_sites_per_thread = 256;
+
+/**
+ * Histograms recorded by one thread at a time. When that thread exits the table keeps its counts
+ * and is handed to the next thread that records, so the number of tables is bounded by the peak
+ * number of recording threads rather than by thread churn.
+ */
+struct PropagationThreadTable {
+    std::array<std::atomic<PropagationSiteMetrics*>, propagation_sites_per_thread> sites{};
+    std::vector<std::unique_ptr<PropagationSiteMetrics>> owned;
+    std::atomic<std::uint64_t> overflow{0};
+    std::atomic<bool> in_use{true};
+
+    PropagationSiteMetrics* site_for(const std::source_location& where) {
+        const auto key = static_cast<std::size_t>(
+            detail::fnv1a((static_cast<std::uint64_t>(where.line()) << 32) | where.column(),
+                          detail::fnv1a(std::string_view{where.file_name()})));
+
+        for (std::size_t probe = 0; probe < propagation_sites_per_thread; ++probe) {
+            auto& slot = sites[(key + probe) % propagation_sites_per_thread];
+            PropagationSiteMetrics* site = slot.load(std::memory_order_relaxed);
+            if (site == nullptr) {
+                owned.push_back(std::make_unique<PropagationSiteMetrics>(PropagationSiteMetrics{where, {}, {}}));
+                slot.store(owned.back().get(), std::memory_order_release);
+                return owned.back().get();
+            }
+            if (site->where.line() == where.line() && site->where.column() == where.column() &&
+                std::string_view{site->where.file_name()} == where.file_name()) {
+                return site;
+            }
+        }
+        return nullptr;
+    }
+};
+
+struct PropagationState {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<PropagationThreadTable>> tables;
+    std::uint64_t start_ticks = 0;
+    std::chrono::steady_clock::time_point start_time;
+
+    PropagationThreadTable* register_thread() {
+        const std::lock_guard lock{mutex};
+        for (const auto& table : tables) {
+            if (!table->in_use.load(std::memory_order_acquire)) {
+                table->in_use.store(true, std::memory_order_relaxed);
+                return table.get();
+            }
+        }
+        tables.push_back(std::make_unique<PropagationThreadTable>());
+        return tables.back().get();
+    }
+};
+
+inline PropagationState& propagation_state() {
+    static PropagationState state;
+    return state;
+}
+
+/** Per-thread recording state; releases the thread's table for reuse when the thread exits. */
+struct PropagationThread {
+    PropagationThread() = default;
+    PropagationThread(const PropagationThread&) = delete;
+    PropagationThread& operator=(const PropagationThread&) = delete;
+
+    ~PropagationThread() {
+        if (table != nullptr) {
+            table->in_use.store(false, std::memory_order_release);
+        }
+    }
+
+    PropagationThreadTable* table = nullptr;
+};
+
+#if FEER_PROPAGATION_METRICS
+inline void record_propagation(const Err& err) {
+    thread_local PropagationThread self;
+    if (self.table == nullptr) {
+        self.table = propagation_state().register_thread();
+    }
+
+    PropagationSiteMetrics* site = self.table->site_for(err.where);
+    if (site == nullptr) {
+        self.table->overflow.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    site->hops.record(err.propagation_hops);
+    // Errors built at compile time have no creation timestamp.
+    if (err.created_ticks != 0) {
+        site->latency_ticks.record(read_ticks() - err.created_ticks);
+    }
+}
+#endif
+
+}  // namespace detail
+
+/**
+ * @brief Starts collecting per-site propagation histograms.
+ *
+ * Requires FEER_PROPAGATION_METRICS=1; otherwise nothing is recorded. Each thread records into
+ * its own table, so handling an error takes no locks after the thread's first one. Tables of
+ * exited threads keep their counts and are reused by new threads.
+ */
+inline void start_propagation_metrics() {
+    detail::PropagationState& state = detail::propagation_state();
+    {
+        const std::lock_guard lock{state.mutex};
+        state.start_ticks = detail::read_ticks();
+        state.start_time = std::chrono::steady_clock::now();
+    }
+#if FEER_PROPAGATION_METRICS
+    detail::propagation_observer.store(&detail::record_propagation, std::memory_order_release);
+#endif
+}
+
+/** @brief Stops collecting. Collected histograms are kept. */
+inline void stop_propagation_metrics() {
+#if FEER_PROPAGATION_METRICS
+    detail::propagation_observer.store(nullptr, std::memory_order_release);
+#endif
+}
+
+/**
+ * @brief Merges the histograms of all threads, one entry per error construction site.
+ */
+[[nodiscard]] inline std::vector<PropagationSiteMetrics> propagation_metrics() {
+    detail::PropagationState& state = detail::propagation_state();
+    const std::lock_guard lock{state.mutex};
+
+    std::vector<PropagationSiteMetrics> merged;
+    for (const auto& table : state.tables) {
+        for (const auto& slot : table->sites) {
+            const PropagationSiteMetrics* site = slot.load(std::memory_order_acquire);
+            if (site == nullptr) {
+                continue;
+            }
+            auto it = std::find_if(merged.begin(), merged.end(), [&](const PropagationSiteMetrics& entry) {
+                return entry.where.line() == site->where.line() && entry.where.column() == site->where.column() &&
+                       std::string_view{entry.where.file_name()} == site->where.file_name();
+            });
+            if (it == merged.end()) {
+                merged.push_back(PropagationSiteMetrics{site->where, {}, {}});
+                it = merged.end() - 1;
+            }
+            it->hops.merge(site->hops);
+            it->latency_ticks.merge(site->latency_ticks);
+        }
+    }
+    return merged;
+}
+
+/**
+ * @brief Writes one line per site: hop count and creation-to-handling latency (ns) at p50/p99/max.
+ */
+inline void write_propagation_report(std::ostream& out) {
+    double ns_per_tick = 0.0;
+    {
+        detail::PropagationState& state = detail::propagation_state();
+        const std::lock_guard lock{state.mutex};
+        const double elapsed_ns =
+            std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - state.start_time).count();
+        const double elapsed_ticks = static_cast<double>(detail::read_ticks() - state.start_ticks);
+        ns_per_tick = elapsed_ticks > 0.0 ? elapsed_ns / elapsed_ticks : 0.0;
+    }
+
+    for (const PropagationSiteMetrics& site : propagation_metrics()) {
+        const auto ns = [&](std::uint64_t ticks) {
+            return static_cast<unsigned long long>(static_cast<double>(ticks) * ns_per_tick);
+        };
+
+        char line[512];
+        std::snprintf(
+            line,
+            sizeof(line),
+            "%s:%u count=%llu hops[p50=%llu p99=%llu max=%llu] latency_ns[p50=%llu p99=%llu max=%llu]\n",
+            site.where.file_name(),
+            static_cast<unsigned>(site.where.line()),
+            static_cast<unsigned long long>(site.hops.count()),
+            static_cast<unsigned long long>(site.hops.percentile(0.5)),
+            static_cast<unsigned long long>(site.hops.percentile(0.99)),
+            static_cast<unsigned long long>(site.hops.max()),
+            ns(site.latency_ticks.percentile(0.5)),
+            ns(site.latency_ticks.percentile(0.99)),
+            ns(site.latency_ticks.max()));
+        out << line;
+    }
+}
+
+}  // namespace feer
@@ -0,0 +1,321 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+/*
+ * Capacity of the NanBoxed error table, set with FEER_NAN_BOX_MAX_ERRORS=<entries>.
+ *
+ * Interned errors are kept until exit, so the table is capped: the last entry is a fixed "table is
+ * full" error that every later distinct error maps to. Must be between 2 and 2^32.
+ */
+#if !defined(FEER_NAN_BOX_MAX_ERRORS)
+#define FEER_NAN_BOX_MAX_ERRORS 4096
+#endif
+
+#if FEER_NAN_BOX_MAX_ERRORS < 2 || FEER_NAN_BOX_MAX_ERRORS > 4294967296
+#error "FEER_NAN_BOX_MAX_ERRORS must be between 2 and 2^32"
+#endif
+
+namespace feer {
+
+/**
+ * @brief Error representation selecting the eight-byte `Result<double, NanBoxed>`.
+ *
+ * Errors are interned into a process-wide table and the Result stores their 32-bit index in the
+ * payload of a quiet NaN.
+ */
+struct NanBoxed {};
+
+namespace detail {
+
+/**
+ * Append-only table of interned errors, holding at most capacity() entries.
+ *
+ * Errors with equal site and message share one entry; payloads are dropped before interning, so
+ * they cannot make otherwise equal errors distinct. Chunk k holds 2^(k + 8) entries, so 25 chunks
+ * cover every 32-bit index without a large static array. Entries are never removed or modified,
+ * so lookups take no lock. The last index is reserved for a "table is full" error: once the other
+ * entries are taken, errors already in the table keep their index and every new one maps there.
+ *
+ * Interning checks a small per-thread cache keyed by the site's address and line first, so a
+ * repeated error costs a few compares and one message compare; only errors the thread has not
+ * seen recently are hashed and looked up under the mutex.
+ */
+class NanBoxTable {
+public:
+    static constexpr unsigned first_chunk_bits = 8;
+    static constexpr std::size_t chunk_count = 33 - first_chunk_bits;
+    static constexpr std::uint64_t max_entries = std::uint64_t{1} << 32;
+    static constexpr std::string_view full_message = "NanBoxed error table is full";
+
+    // Never destroyed: Results may still refer to interned errors from other static destructors.
+    static NanBoxTable& instance() {
+        static NanBoxTable* const table = new NanBoxTable{FEER_NAN_BOX_MAX_ERRORS};
+        return *table;
+    }
+
+    /** Creates a table of capacity entries, including the "table is full" entry; 2 <= capacity <= 2^32. */
+    explicit NanBoxTable(std::uint64_t capacity) noexcept : m_capacity(capacity) {
+        static std::atomic<std::uint64_t> next_id{1};
+        m_id = next_id.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ~NanBoxTable() {
+        for (std::uint64_t index = 0; index < m_size; ++index) {
+            const auto [chunk, offset] = locate(static_cast<std::uint32_t>(index));
+            std::destroy_at(m_chunks[chunk].load(std::memory_order_relaxed) + offset);
+        }
+    }
+
+    NanBoxTable(const NanBoxTable&) = delete;
+    NanBoxTable& operator=(const NanBoxTable&) = delete;
+
+    std::uint32_t intern(Err&& err) {
+        thread_local CacheSlot cache[cache_slots]{};
+        CacheSlot& slot = cache[cache_key(err.where) % cache_slots];
+        if (slot.table == m_id && slot.file == err.where.file_name() && slot.line == err.where.line() &&
+            slot.column == err.where.column() && get(slot.index).message == err.message) {
+            return slot.index;
+        }
+
+        const std::source_location where = err.where;
+        const std::uint32_t index = intern_locked(FEER_MOVE(err));
+        slot = CacheSlot{m_id, where.file_name(), where.line(), where.column(), index};
+        return index;
+    }
+
+    /** Index every distinct error maps to once the table is full. */
+    [[nodiscard]] std::uint32_t full_index() const noexcept { return static_cast<std::uint32_t>(m_capacity - 1); }
+
+    [[nodiscard]] std::uint64_t capacity() const noexcept { return m_capacity; }
+
+    [[nodiscard]] const Err& get(std::uint32_t index) const noexcept {
+        const auto [chunk, offset] = locate(index);
+        return m_chunks[chunk].load(std::memory_order_acquire)[offset];
+    }
+
+private:
+    static constexpr std::size_t cache_slots = 64;
+
+    struct CacheSlot {
+        std::uint64_t table = 0;
+        const char* file = nullptr;
+        std::uint_least32_t line = 0;
+        std::uint_least32_t column = 0;
+        std::uint32_t index = 0;
+    };
+
+    struct Entry {
+        alignas(Err) unsigned char bytes[sizeof(Err)];
+    };
+
+    struct Location {
+        std::size_t chunk;
+        std::size_t offset;
+    };
+
+    static std::size_t cache_key(const std::source_location& where) noexcept {
+        return (reinterpret_cast<std::uintptr_t>(where.file_name()) >> 3) ^ (std::size_t{where.line()} * 31) ^
+               where.column();
+    }
+
+    static constexpr Location locate(std::uint32_t index) noexcept {
+        const std::uint64_t biased = std::uint64_t{index} + (std::uint64_t{1} << first_chunk_bits);
+        const auto chunk = static_cast<std::size_t>(std::bit_width(biased)) - 1 - first_chunk_bits;
+        return {chunk, static_cast<std::size_t>(biased - (std::uint64_t{1} << (chunk + first_chunk_bits)))};
+    }
+
+    static bool same_error(const Err& lhs, const Err& rhs) noexcept {
+        return lhs.where.line() == rhs.where.line() && lhs.where.column() == rhs.where.column() &&
+               std::string_view{lhs.where.file_name()} == rhs.where.file_name() && lhs.message == rhs.message;
+    }
+
+    std::uint32_t intern_locked(Err&& err) {
+        const std::uint64_t fingerprint = feer::fingerprint(err.where, err.message);
+        const std::lock_guard lock{m_mutex};
+
+        const auto [first, last] = m_index.equal_range(fingerprint);
+        for (auto it = first; it != last; ++it) {
+            if (same_error(get(it->second), err)) {
+                return it->second;
+            }
+        }
+
+        if (m_size == m_capacity) [[unlikely]] {
+            return full_index();
+        }
+        if (m_size == m_capacity - 1) [[unlikely]] {
+            // Not added to m_index, so an error with the same message is not taken for it.
+            return append(Err{std::string{full_message}});
+        }
+#if FEER_ERR_PAYLOADS
+        err.clear_payload();
+#endif
+        const std::uint32_t index = append(FEER_MOVE(err));
+        m_index.emplace(fingerprint, index);
+        return index;
+    }
+
+    // Caller holds m_mutex and has checked that m_size < m_capacity.
+    std::uint32_t append(Err&& err) {
+        const auto index = static_cast<std::uint32_t>(m_size);
+        const auto [chunk, offset] = locate(index);
+        Err* entries = m_chunks[chunk].load(std::memory_order_relaxed);
+        if (entries == nullptr) {
+            m_owned[chunk] = std::make_unique<Entry[]>(std::size_t{1} << (chunk + first_chunk_bits));
+            entries = reinterpret_cast<Err*>(m_owned[chunk].get());
+        }
+        std::construct_at(entries + offset, FEER_MOVE(err));
+        m_chunks[chunk].store(entries, std::memory_order_release);
+        ++m_size;
+        return index;
+    }
+
+    const std::uint64_t m_capacity;
+    // Tags cache slots, which outlive a table that is not the process-wide one.
+    std::uint64_t m_id;
+    std::mutex m_mutex;
+    std::unordered_multimap<std::uint64_t, std::uint32_t> m_index;
+    std::atomic<Err*> m_chunks[chunk_count]{};
+    std::unique_ptr<Entry[]> m_owned[chunk_count];
+    std::uint64_t m_size = 0;
+};
+
+}  // namespace detail
+
+/**
+ * @brief `Result<double>` in exactly eight bytes.
+ *
+ * Errors are stored as negative quiet NaNs whose top 16 bits are all set; the low 32 bits are an
+ * index into an interning table, so `is_ok()` is a single unsigned compare and arrays of Results
+ * are arrays of doubles that vectorize like them. A success value that happens to be a NaN in
+ * that range is stored as the canonical quiet NaN.
+ *
+ * Interned errors are shared and immutable: error() returns const Err&, payloads are dropped,
+ * propagation hop counts are not tracked and every distinct (site, message) pair is kept until
+ * exit. The table holds FEER_NAN_BOX_MAX_ERRORS entries (4096 by default); past that every new
+ * distinct error reads as "NanBoxed error table is full", so avoid messages that embed ids, paths
+ * or other dynamic text. Hooks and probes fire as for Err; the inspection and audit modes do not
+ * apply.
+ *
+ * Each error still constructs an Err before it is interned; an error its thread returned recently
+ * from the same site is then found in a per-thread cache, while a new one is hashed and looked up
+ * under a mutex. Errors with ever-changing messages take that slow path every time.
+ *
+ * @code
+ * feer::Result<double, feer::NanBoxed> safe_sqrt(double x) {
+ *     if (x < 0) {
+ *         return feer::Err{"negative input"};
+ *     }
+ *     return std::sqrt(x);
+ * }
+ * @endcode
+ */
+template <>
+class BasicResult<double, NanBoxed, DefaultPolicy> {
+public:
+    using value_type = double;
+
+    /** Bit patterns at or above this are errors. */
+    static constexpr std::uint64_t error_bits = 0xFFFF'0000'0000'0000;
+
+    /** Construct success result. */
+    FEER_ALWAYS_INLINE constexpr BasicResult(double value) noexcept : m_bits(std::bit_cast<std::uint64_t>(value)) {
+        if (m_bits >= error_bits) [[unlikely]] {
+            m_bits = std::bit_cast<std::uint64_t>(std::numeric_limits<double>::quiet_NaN());
+        }
+    }
+
+    /** Construct error result from lvalue Err. */
+    FEER_ERR_COLD BasicResult(const Err& err) : BasicResult(Err{err}) {}
+
+    /** Construct error result from rvalue Err. */
+    FEER_ERR_COLD BasicResult(Err&& err) : m_bits(error_bits | detail::NanBoxTable::instance().intern(FEER_MOVE(err))) {}
+
+    /** @brief True when this object currently holds a success value. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool is_ok() const noexcept { return m_bits < error_bits; }
+
+    /** @brief True when this object currently holds an error. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool is_err() const noexcept { return m_bits >= error_bits; }
+
+    /** @brief Convenience bool conversion. Equivalent to is_ok(). */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr explicit operator bool() const noexcept { return is_ok(); }
+
+    /**
+     * @brief Returns the success value.
+     * @throws std::bad_variant_access if current state is error.
+     */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr double value() const {
+        if (is_err()) [[unlikely]] {
+            detail::ErrOps::bad_access();
+        }
+        return std::bit_cast<double>(m_bits);
+    }
+
+    /**
+     * @brief Returns contained value or fallback if in error state. Branch-free, so loops over arrays vectorize.
+     * @param default_value Fallback value.
+     */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr double value_or(double default_value) const noexcept {
+        return is_ok() ? std::bit_cast<double>(m_bits) : default_value;
+    }
+
+    /**
+     * @brief Returns the interned error.
+     * @throws std::bad_variant_access if current state is success.
+     */
+    [[nodiscard]] const Err& error() const {
+        if (is_ok()) [[unlikely]] {
+            detail::ErrOps::bad_access();
+        }
+        return detail::NanBoxTable::instance().get(error_index());
+    }
+
+    /** @brief Index of the error in the interning table. Only meaningful in error state. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr std::uint32_t error_index() const noexcept {
+        return static_cast<std::uint32_t>(m_bits);
+    }
+
+    /**
+     * @brief Pattern match over success/error state.
+     * @param on_ok Called with the value when state is ok.
+     * @param on_err Called with const Err when state is error.
+     * @return Handler return value. Both handlers must return the same type.
+     */
+    template <typename OkFn, typename ErrFn>
+    [[nodiscard]] FEER_ALWAYS_INLINE auto match(OkFn&& on_ok, ErrFn&& on_err) const {
+        using ok_return_type = std::invoke_result_t<OkFn, double>;
+        using err_return_type = std::invoke_result_t<ErrFn, const Err&>;
+
+        static_assert(
+            std::is_same_v<ok_return_type, err_return_type>,
+            "match requires both handlers to return the same type");
+
+        if (is_ok()) FEER_OK_BRANCH {
+            return detail::invoke(FEER_FORWARD(on_ok), std::bit_cast<double>(m_bits));
+        }
+        const Err& err = error();
+        detail::err_handled(err);
+        return detail::invoke(FEER_FORWARD(on_err), err);
+    }
+
+private:
+    std::uint64_t m_bits;
+};
+
+static_assert(sizeof(Result<double, NanBoxed>) == sizeof(double));
+static_assert(std::is_trivially_copyable_v<Result<double, NanBoxed>>);
+
+}  // namespace feer
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace feer {
+
+namespace detail {
+
+template <std::size_t Size>
+struct packed_bits_of;
+
+template <>
+struct packed_bits_of<1> {
+    using type = std::uint8_t;
+};
+
+template <>
+struct packed_bits_of<2> {
+    using type = std::uint16_t;
+};
+
+template <>
+struct packed_bits_of<4> {
+    using type = std::uint32_t;
+};
+
+template <typename T>
+inline constexpr bool packable =
+    std::is_trivially_copyable_v<T> && !std::is_const_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4);
+
+}  // namespace detail
+
+/**
+ * @brief Result of a small value or a small error code, packed into one `std::uint64_t`.
+ *
+ * Bit 63 is the tag; the value or the error occupies the low 32 bits. The object is a single
+ * integer, so it is returned in one register and every accessor is constexpr. Use it for hot
+ * paths returning codes such as `PackedResult<std::uint32_t, ParseStatus>`; use Result<T> when the
+ * error needs a message and location.
+ *
+ * @tparam T Success type: trivially copyable, 1, 2 or 4 bytes.
+ * @tparam E Error type: trivially copyable, 1, 2 or 4 bytes, usually an enum.
+ *
+ * @code
+ * feer::PackedResult<std::uint16_t, PortError> parse_port(std::string_view text);
+ *
+ * const std::uint16_t port = parse_port(text).value_or(80);
+ * @endcode
+ */
+template <typename T, typename E>
+class PackedResult {
+
+    static_assert(detail::packable<T>, "PackedResult<T, E>: T must be trivially copyable and 1, 2 or 4 bytes");
+    static_assert(detail::packable<E>, "PackedResult<T, E>: E must be trivially copyable and 1, 2 or 4 bytes");
+
+    using value_bits = typename detail::packed_bits_of<sizeof(T)>::type;
+    using error_bits = typename detail::packed_bits_of<sizeof(E)>::type;
+
+public:
+    using value_type = T;
+    using error_type = E;
+
+    /** Tag bit set in error state. */
+    static constexpr std::uint64_t err_tag = std::uint64_t{1} << 63;
+
+    /** Construct success result. */
+    FEER_ALWAYS_INLINE constexpr PackedResult(T value) noexcept requires(!std::is_same_v<T, E>)
+        : m_bits(std::bit_cast<value_bits>(value)) {}
+
+    /** Construct error result. */
+    template <typename U>
+        requires(std::is_same_v<U, E> && !std::is_same_v<T, E>)
+    FEER_ALWAYS_INLINE constexpr PackedResult(U error) noexcept : m_bits(err_tag | std::bit_cast<error_bits>(error)) {}
+
+    /** @brief Success result; the only way to construct one when T and E are the same type. */
+    [[nodiscard]] FEER_ALWAYS_INLINE static constexpr PackedResult ok(T value) noexcept {
+        return PackedResult{std::bit_cast<value_bits>(value), raw_tag{}};
+    }
+
+    /** @brief Error result; the only way to construct one when T and E are the same type. */
+    [[nodiscard]] FEER_ALWAYS_INLINE static constexpr PackedResult err(E error) noexcept {
+        return PackedResult{err_tag | std::bit_cast<error_bits>(error), raw_tag{}};
+    }
+
+    /** @brief Rebuilds a result from bits(), e.g. after passing it through a C interface. */
+    [[nodiscard]] FEER_ALWAYS_INLINE static constexpr PackedResult from_bits(std::uint64_t bits) noexcept {
+        return PackedResult{bits, raw_tag{}};
+    }
+
+    /** @brief The packed representation. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr std::uint64_t bits() const noexcept { return m_bits; }
+
+    /** @brief True when this object currently holds a success value. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool is_ok() const noexcept { return (m_bits & err_tag) == 0; }
+
+    /** @brief True when this object currently holds an error. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool is_err() const noexcept { return (m_bits & err_tag) != 0; }
+
+    /** @brief Convenience bool conversion. Equivalent to is_ok(). */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr explicit operator bool() const noexcept { return is_ok(); }
+
+    /**
+     * @brief Returns the success value.
+     * @throws std::bad_variant_access if current state is error.
+     */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr T value() const {
+        if (is_err()) [[unlikely]] {
+            detail::ErrOps::bad_access();
+        }
+        return unpack_value();
+    }
+
+    /**
+     * @brief Returns the error.
+     * @throws std::bad_variant_access if current state is success.
+     */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr E error() const {
+        if (is_ok()) [[unlikely]] {
+            detail::ErrOps::bad_access();
+        }
+        return unpack_error();
+    }
+
+    /**
+     * @brief Returns contained value or fallback if in error state.
+     * @param default_value Fallback value. noexcept only when converting it to T cannot throw.
+     */
+    template <typename U>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr T value_or(U&& default_value) const
+        noexcept(std::is_nothrow_constructible_v<T, U>) {
+        static_assert(std::is_convertible_v<U, T>, "value_or requires U convertible to T");
+        return is_ok() ? unpack_value() : static_cast<T>(FEER_FORWARD(default_value));
+    }
+
+    /**
+     * @brief Pattern match over success/error state.
+     * @param on_ok Called with the value when state is ok.
+     * @param on_err Called with the error when state is error.
+     * @return Handler return value. Both handlers must return the same type.
+     */
+    template <typename OkFn, typename ErrFn>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto match(OkFn&& on_ok, ErrFn&& on_err) const {
+        using ok_return_type = std::invoke_result_t<OkFn, T>;
+        using err_return_type = std::invoke_result_t<ErrFn, E>;
+
+        static_assert(
+            std::is_same_v<ok_return_type, err_return_type>,
+            "match requires both handlers to return the same type");
+
+        if (is_ok()) FEER_OK_BRANCH {
+            return detail::invoke(FEER_FORWARD(on_ok), unpack_value());
+        }
+        return detail::invoke(FEER_FORWARD(on_err), unpack_error());
+    }
+
+private:
+    struct raw_tag {};
+
+    FEER_ALWAYS_INLINE constexpr PackedResult(std::uint64_t bits, raw_tag) noexcept : m_bits(bits) {}
+
+    FEER_ALWAYS_INLINE constexpr T unpack_value() const noexcept {
+        return std::bit_cast<T>(static_cast<value_bits>(m_bits));
+    }
+
+    FEER_ALWAYS_INLINE constexpr E unpack_error() const noexcept {
+        return std::bit_cast<E>(static_cast<error_bits>(m_bits));
+    }
+
+    std::uint64_t m_bits;
+};
+
+}  // namespace feer
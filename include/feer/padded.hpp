@@ -0,0 +1,237 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace feer {
+
+/**
+ * @brief Distance in bytes that keeps two objects written by different threads off one cache line.
+ *
+ * A fixed value per target architecture: 128 on AArch64 and Apple platforms, whose cores use
+ * 128-byte lines or adjacent-line prefetch, and 64 elsewhere. Deliberately not
+ * std::hardware_destructive_interference_size, which GCC derives from -mtune: translation units
+ * built with different tuning flags would disagree on the layout of PaddedSlot.
+ */
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__APPLE__)
+inline constexpr std::size_t cache_line_size = 128;
+#else
+inline constexpr std::size_t cache_line_size = 64;
+#endif
+
+/**
+ * @brief One Result<T> on its own cache line, empty until written.
+ *
+ * Give each writer thread its own slot, e.g. in a `std::vector<PaddedSlot<T>>`, and neighbouring
+ * writes no longer invalidate each other's cache lines.
+ */
+template <typename T>
+class alignas(cache_line_size) PaddedSlot {
+public:
+    /** Holds no Result. */
+    constexpr PaddedSlot() noexcept = default;
+
+    /** @brief Constructs the held Result from args, replacing any previous one. */
+    template <typename... Args>
+    Result<T>& emplace(Args&&... args) {
+        return m_result.emplace(FEER_FORWARD(args)...);
+    }
+
+    /** @brief True when a Result has been written. */
+    [[nodiscard]] bool has_result() const noexcept { return m_result.has_value(); }
+
+    /** @brief The held Result, or nullptr when none has been written. */
+    [[nodiscard]] Result<T>* get() noexcept { return m_result ? std::addressof(*m_result) : nullptr; }
+
+    /** @brief The held Result, or nullptr when none has been written. */
+    [[nodiscard]] const Result<T>* get() const noexcept { return m_result ? std::addressof(*m_result) : nullptr; }
+
+    /**
+     * @brief Moves the held Result out and leaves the slot empty.
+     * @return The Result, or an Err when nothing was written.
+     */
+    [[nodiscard]] Result<T> take(const std::source_location& where = std::source_location::current()) {
+        if (!m_result) [[unlikely]] {
+            return Err{"PaddedSlot was never written", where};
+        }
+        Result<T> out = FEER_MOVE(*m_result);
+        m_result.reset();
+        return out;
+    }
+
+private:
+    std::optional<Result<T>> m_result;
+};
+
+/**
+ * @brief Fixed number of Result<T> slots filled by parallel writers without false sharing.
+ *
+ * With one argument every slot starts its own cache line. With a chunk count the slots are split
+ * into that many contiguous chunks, one per writer thread: each chunk starts on a cache line and
+ * its slots are packed, so only the owning thread touches those lines and memory grows with the
+ * number of threads rather than the number of slots.
+ *
+ * Different indices may be written concurrently. Reading requires the writers to have finished,
+ * e.g. joined. compact() then hands the consumer a dense `std::vector<Result<T>>` in index order.
+ * Indices are not bounds-checked. Move-only.
+ *
+ * @code
+ * feer::PaddedResultArray<Row> rows{jobs.size(), workers};
+ * for (std::size_t w = 0; w < workers; ++w) {
+ *     pool.emplace_back([&, w] {
+ *         const auto [begin, end] = rows.chunk(w);
+ *         for (std::size_t i = begin; i < end; ++i) {
+ *             rows.emplace(i, parse(jobs[i]));
+ *         }
+ *     });
+ * }
+ * join(pool);
+ * std::vector<feer::Result<Row>> results = rows.compact();
+ * @endcode
+ */
+template <typename T>
+class PaddedResultArray {
+    using slot_type = std::optional<Result<T>>;
+
+    static_assert(alignof(slot_type) <= cache_line_size, "PaddedResultArray<T>: Result<T> is over-aligned");
+
+public:
+    using result_type = Result<T>;
+
+    /** Index range [begin, end) of one chunk. */
+    struct Range {
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    /** size empty slots, each on its own cache line. */
+    explicit PaddedResultArray(std::size_t size) : PaddedResultArray(size, size) {}
+
+    /** size empty slots in chunks contiguous chunks, each starting on a cache line. 0 chunks gives one per slot. */
+    PaddedResultArray(std::size_t size, std::size_t chunks)
+        : m_size(size),
+          m_chunk_size(chunks == 0 || size == 0 ? 1 : (size + chunks - 1) / chunks),
+          m_chunk_bytes(round_up(m_chunk_size * sizeof(slot_type))) {
+        if (m_size == 0) {
+            return;
+        }
+        m_bytes = static_cast<std::byte*>(::operator new(allocated_bytes(), std::align_val_t{cache_line_size}));
+        for (std::size_t i = 0; i < m_size; ++i) {
+            ::new (static_cast<void*>(address(i))) slot_type{};
+        }
+    }
+
+    PaddedResultArray(PaddedResultArray&& other) noexcept
+        : m_size(std::exchange(other.m_size, 0)),
+          m_chunk_size(other.m_chunk_size),
+          m_chunk_bytes(other.m_chunk_bytes),
+          m_bytes(std::exchange(other.m_bytes, nullptr)) {}
+
+    PaddedResultArray& operator=(PaddedResultArray&& other) noexcept {
+        if (this != &other) {
+            release();
+            m_size = std::exchange(other.m_size, 0);
+            m_chunk_size = other.m_chunk_size;
+            m_chunk_bytes = other.m_chunk_bytes;
+            m_bytes = std::exchange(other.m_bytes, nullptr);
+        }
+        return *this;
+    }
+
+    PaddedResultArray(const PaddedResultArray&) = delete;
+    PaddedResultArray& operator=(const PaddedResultArray&) = delete;
+
+    ~PaddedResultArray() { release(); }
+
+    /** @brief Number of slots. */
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+    /** @brief Slots per chunk; 1 when every slot has its own cache line. */
+    [[nodiscard]] std::size_t chunk_size() const noexcept { return m_chunk_size; }
+
+    /** @brief Number of non-empty chunks. */
+    [[nodiscard]] std::size_t chunk_count() const noexcept { return (m_size + m_chunk_size - 1) / m_chunk_size; }
+
+    /** @brief Indices of chunk; empty when chunk >= chunk_count(). */
+    [[nodiscard]] Range chunk(std::size_t chunk) const noexcept {
+        const std::size_t begin = chunk < chunk_count() ? chunk * m_chunk_size : m_size;
+        return {begin, begin + m_chunk_size < m_size ? begin + m_chunk_size : m_size};
+    }
+
+    /** @brief Bytes allocated for the slots, including padding. */
+    [[nodiscard]] std::size_t allocated_bytes() const noexcept { return chunk_count() * m_chunk_bytes; }
+
+    /** @brief Constructs the Result at index from args, replacing any previous one. */
+    template <typename... Args>
+    Result<T>& emplace(std::size_t index, Args&&... args) {
+        return slot(index).emplace(FEER_FORWARD(args)...);
+    }
+
+    /** @brief True when index has been written. */
+    [[nodiscard]] bool has_result(std::size_t index) const noexcept { return slot(index).has_value(); }
+
+    /** @brief The Result at index. index must have been written. */
+    [[nodiscard]] Result<T>& operator[](std::size_t index) noexcept { return *slot(index); }
+
+    /** @brief The Result at index. index must have been written. */
+    [[nodiscard]] const Result<T>& operator[](std::size_t index) const noexcept { return *slot(index); }
+
+    /**
+     * @brief Moves every Result out, in index order, and leaves all slots empty.
+     *
+     * A slot that was never written yields an Err naming its index.
+     */
+    [[nodiscard]] std::vector<Result<T>> compact(
+        const std::source_location& where = std::source_location::current()) {
+        std::vector<Result<T>> out;
+        out.reserve(m_size);
+        for (std::size_t i = 0; i < m_size; ++i) {
+            slot_type& held = slot(i);
+            if (!held) [[unlikely]] {
+                out.emplace_back(Err{"PaddedResultArray slot " + std::to_string(i) + " was never written", where});
+                continue;
+            }
+            out.emplace_back(FEER_MOVE(*held));
+            held.reset();
+        }
+        return out;
+    }
+
+private:
+    static constexpr std::size_t round_up(std::size_t bytes) noexcept {
+        return (bytes + cache_line_size - 1) / cache_line_size * cache_line_size;
+    }
+
+    std::byte* address(std::size_t index) const noexcept {
+        return m_bytes + index / m_chunk_size * m_chunk_bytes + index % m_chunk_size * sizeof(slot_type);
+    }
+
+    slot_type& slot(std::size_t index) const noexcept {
+        return *std::launder(reinterpret_cast<slot_type*>(address(index)));
+    }
+
+    void release() noexcept {
+        if (m_bytes == nullptr) {
+            return;
+        }
+        for (std::size_t i = 0; i < m_size; ++i) {
+            std::destroy_at(std::addressof(slot(i)));
+        }
+        ::operator delete(m_bytes, allocated_bytes(), std::align_val_t{cache_line_size});
+        m_bytes = nullptr;
+    }
+
+    std::size_t m_size;
+    std::size_t m_chunk_size;
+    std::size_t m_chunk_bytes;
+    std::byte* m_bytes = nullptr;
+};
+
+}  // namespace feer
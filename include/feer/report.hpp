@@ -0,0 +1,148 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace feer {
+
+/**
+ * @brief Destination of reported errors.
+ *
+ * Called concurrently from any reporting thread; must be thread-safe.
+ */
+using ErrSink = void (*)(const Err& err);
+
+namespace detail {
+
+inline void stderr_sink(const Err& err) {
+    std::fprintf(
+        stderr, "%s:%u: %s\n", err.where.file_name(), static_cast<unsigned>(err.where.line()), err.message.c_str());
+}
+
+inline std::atomic<ErrSink> err_sink{&stderr_sink};
+
+}  // namespace detail
+
+/**
+ * @brief Installs the sink used by report_err. Defaults to one line per error on stderr.
+ * @param sink New sink, or nullptr to restore the default.
+ * @return Previously installed sink.
+ */
+inline ErrSink set_err_sink(ErrSink sink) noexcept {
+    return detail::err_sink.exchange(sink != nullptr ? sink : &detail::stderr_sink, std::memory_order_acq_rel);
+}
+
+/**
+ * @brief Sends err to the installed sink.
+ */
+inline void report_err(const Err& err) {
+    detail::err_sink.load(std::memory_order_acquire)(err);
+}
+
+/**
+ * @brief Sends the error of result to the installed sink, if it holds one.
+ * @return True when an error was reported.
+ */
+template <typename T>
+bool report_err(const Result<T>& result) {
+    if (result.is_ok()) {
+        return false;
+    }
+    report_err(result.error());
+    return true;
+}
+
+/**
+ * @brief Lock-free token bucket, implemented as a generic cell rate algorithm.
+ *
+ * Admits a sustained `per_second` events per second with bursts of up to `per_second` events.
+ * State is a single atomic "theoretical arrival time": a rejected event costs one relaxed load,
+ * an admitted event one compare-exchange.
+ */
+class RateLimiter {
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Constructs a RateLimiter.
+     * @param per_second Admitted events per second. Must be greater than zero.
+     */
+    constexpr explicit RateLimiter(std::uint32_t per_second) noexcept
+        : m_interval_ns(1'000'000'000 / static_cast<std::int64_t>(per_second)),
+          m_tolerance_ns(m_interval_ns * (static_cast<std::int64_t>(per_second) - 1)) {}
+
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+
+    /**
+     * @brief Consumes one token if available.
+     * @param now Event time.
+     * @return True when the event is admitted.
+     */
+    [[nodiscard]] bool try_acquire(clock::time_point now = clock::now()) noexcept {
+        const std::int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+
+        std::int64_t tat = m_tat.load(std::memory_order_relaxed);
+        for (;;) {
+            if (tat - now_ns > m_tolerance_ns) {
+                return false;
+            }
+            const std::int64_t next = (tat > now_ns ? tat : now_ns) + m_interval_ns;
+            if (m_tat.compare_exchange_weak(tat, next, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+private:
+    std::int64_t m_interval_ns;
+    std::int64_t m_tolerance_ns;
+    std::atomic<std::int64_t> m_tat{0};
+};
+
+/**
+ * @brief Reports err through limiter.
+ * @return True when the error was admitted and reported.
+ */
+inline bool report_err_rate_limited(RateLimiter& limiter, const Err& err) {
+    if (!limiter.try_acquire()) {
+        return false;
+    }
+    report_err(err);
+    return true;
+}
+
+/**
+ * @brief Reports the error of result through limiter, if it holds one.
+ * @return True when an error was admitted and reported.
+ */
+template <typename T>
+bool report_err_rate_limited(RateLimiter& limiter, const Result<T>& result) {
+    if (result.is_ok()) {
+        return false;
+    }
+    return report_err_rate_limited(limiter, result.error());
+}
+
+}  // namespace feer
+
+/**
+ * @brief Reports the error of result, admitting at most per_second errors per second from this call site.
+ *
+ * Each expansion owns a constant-initialized RateLimiter, so there is no static-init guard and no
+ * lock on the reporting path. per_second must be a constant expression. Evaluates to true when an
+ * error was reported.
+ *
+ * @code
+ * FEER_REPORT_ERR_RATE_LIMITED(result, 10);
+ * @endcode
+ */
+#define FEER_REPORT_ERR_RATE_LIMITED(result, per_second)                          \
+    ([&]() -> bool {                                                              \
+        static constinit ::feer::RateLimiter feer_rate_limiter_{(per_second)};    \
+        return ::feer::report_err_rate_limited(feer_rate_limiter_, (result));     \
+    }())
@@ -0,0 +1,238 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace feer {
+
+namespace detail {
+
+template <typename T, std::size_t N>
+inline constexpr std::size_t simd_alignment =
+    std::bit_ceil(sizeof(T) * N) < 64 ? std::bit_ceil(sizeof(T) * N) : std::size_t{64};
+
+}  // namespace detail
+
+/**
+ * @brief N lane-wise results: one value and one error code per lane.
+ *
+ * Code 0 means the lane succeeded; any other code is that lane's error. Values and codes are kept
+ * in separate aligned arrays (structure of arrays) and every operation is a branch-free loop over
+ * all lanes, so kernels validating many records at once compile to vector instructions instead of
+ * one Result per element. A failed lane's value is value-initialized.
+ *
+ * @tparam T Lane value type. Must be trivially copyable and default constructible.
+ * @tparam N Number of lanes.
+ * @tparam Code Error code type, integral or enum.
+ *
+ * @code
+ * feer::SimdResult<float, 16> prices{raw_prices};
+ * prices.validate([](float p) { return p >= 0.0F ? 0U : 1U; });
+ * if (const std::size_t lane = prices.first_err_lane(); lane != prices.size()) {
+ *     reject(records[lane], prices.error(lane));
+ * }
+ * @endcode
+ */
+template <typename T, std::size_t N, typename Code = std::uint32_t>
+class SimdResult {
+
+    static_assert(N > 0, "SimdResult<T, N>: N must be greater than zero");
+    static_assert(
+        std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>,
+        "SimdResult<T, N>: T must be trivially copyable and default constructible");
+    static_assert(
+        std::is_integral_v<Code> || std::is_enum_v<Code>,
+        "SimdResult<T, N, Code>: Code must be an integral or enum type");
+
+public:
+    using value_type = T;
+    using code_type = Code;
+
+    /** Code of a successful lane. */
+    static constexpr Code ok_code = Code{};
+
+    /** All lanes succeed with value-initialized values. */
+    constexpr SimdResult() noexcept = default;
+
+    /** All lanes succeed with values. */
+    constexpr explicit SimdResult(const std::array<T, N>& values) noexcept : m_values(values) {}
+
+    /**
+     * @brief Lanes with code 0 succeed with their value; the others fail with their code.
+     *
+     * Values of failed lanes are reset to T{}.
+     */
+    constexpr SimdResult(const std::array<T, N>& values, const std::array<Code, N>& codes) noexcept
+        : m_values(values), m_codes(codes) {
+        for (std::size_t lane = 0; lane < N; ++lane) {
+            m_values[lane] = m_codes[lane] == ok_code ? m_values[lane] : T{};
+        }
+    }
+
+    /** @brief Number of lanes. */
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+
+    /** @brief Marks lane as succeeded with value. */
+    constexpr void set_ok(std::size_t lane, const T& value) noexcept {
+        m_values[lane] = value;
+        m_codes[lane] = ok_code;
+    }
+
+    /**
+     * @brief Marks lane as failed with code.
+     * @throws std::invalid_argument if code is ok_code, which would mark the lane as succeeded; the lane is unchanged.
+     */
+    constexpr void set_err(std::size_t lane, Code code) {
+        if (code == ok_code) [[unlikely]] {
+            throw std::invalid_argument{"feer::SimdResult::set_err: code 0 marks a lane as succeeded"};
+        }
+        m_values[lane] = T{};
+        m_codes[lane] = code;
+    }
+
+    /** @brief True when lane succeeded. */
+    [[nodiscard]] constexpr bool is_ok(std::size_t lane) const noexcept { return m_codes[lane] == ok_code; }
+
+    /** @brief True when lane failed. */
+    [[nodiscard]] constexpr bool is_err(std::size_t lane) const noexcept { return m_codes[lane] != ok_code; }
+
+    /** @brief Bit i is set when lane i succeeded. */
+    [[nodiscard]] constexpr std::bitset<N> ok_mask() const noexcept {
+        std::bitset<N> mask;
+        for (std::size_t lane = 0; lane < N; ++lane) {
+            mask[lane] = m_codes[lane] == ok_code;
+        }
+        return mask;
+    }
+
+    /** @brief Number of failed lanes. */
+    [[nodiscard]] constexpr std::size_t err_count() const noexcept {
+        std::size_t count = 0;
+        for (std::size_t lane = 0; lane < N; ++lane) {
+            count += m_codes[lane] != ok_code ? 1 : 0;
+        }
+        return count;
+    }
+
+    /** @brief True when every lane succeeded. */
+    [[nodiscard]] constexpr bool all_ok() const noexcept { return err_count() == 0; }
+
+    /**
+     * @brief Lowest failing lane, or size() when every lane succeeded.
+     *
+     * Computed as a min-reduction over all lanes rather than an early-exit scan.
+     */
+    [[nodiscard]] constexpr std::size_t first_err_lane() const noexcept {
+        std::size_t first = N;
+        for (std::size_t lane = 0; lane < N; ++lane) {
+            const std::size_t candidate = m_codes[lane] != ok_code ? lane : N;
+            first = candidate < first ? candidate : first;
+        }
+        return first;
+    }
+
+    /**
+     * @brief Returns the value of lane.
+     * @throws std::bad_variant_access if lane failed.
+     */
+    [[nodiscard]] constexpr const T& value(std::size_t lane) const {
+        if (is_err(lane)) [[unlikely]] {
+            detail::ErrOps::bad_access();
+        }
+        return m_values[lane];
+    }
+
+    /**
+     * @brief Returns the error code of lane.
+     * @throws std::bad_variant_access if lane succeeded.
+     */
+    [[nodiscard]] constexpr Code error(std::size_t lane) const {
+        if (is_ok(lane)) [[unlikely]] {
+            detail::ErrOps::bad_access();
+        }
+        return m_codes[lane];
+    }
+
+    /** @brief All values; failed lanes hold T{}. */
+    [[nodiscard]] constexpr const std::array<T, N>& values() const noexcept { return m_values; }
+
+    /** @brief All codes; successful lanes hold 0. */
+    [[nodiscard]] constexpr const std::array<Code, N>& codes() const noexcept { return m_codes; }
+
+    /**
+     * @brief Blends values with fallback: failed lanes take default_value.
+     */
+    [[nodiscard]] constexpr std::array<T, N> value_or(const T& default_value) const noexcept {
+        std::array<T, N> out;
+        for (std::size_t lane = 0; lane < N; ++lane) {
+            out[lane] = m_codes[lane] == ok_code ? m_values[lane] : default_value;
+        }
+        return out;
+    }
+
+    /**
+     * @brief Blends values with per-lane fallbacks: failed lane i takes default_values[i].
+     */
+    [[nodiscard]] constexpr std::array<T, N> value_or(const std::array<T, N>& default_values) const noexcept {
+        std::array<T, N> out;
+        for (std::size_t lane = 0; lane < N; ++lane) {
+            out[lane] = m_codes[lane] == ok_code ? m_values[lane] : default_values[lane];
+        }
+        return out;
+    }
+
+    /**
+     * @brief Masked map: applies fn to the value of every lane, keeping failed lanes failed.
+     *
+     * fn runs on all lanes, including failed ones (with T{}), so the loop vectorizes; results of
+     * failed lanes are discarded. fn must be cheap and side-effect free.
+     *
+     * @return SimdResult of fn's result type with the same codes.
+     */
+    template <typename Fn>
+    [[nodiscard]] constexpr auto map(Fn&& fn) const {
+        using mapped_type = std::remove_cvref_t<std::invoke_result_t<Fn&, const T&>>;
+
+        SimdResult<mapped_type, N, Code> out;
+        for (std::size_t lane = 0; lane < N; ++lane) {
+            const mapped_type mapped = fn(m_values[lane]);
+            out.m_values[lane] = m_codes[lane] == ok_code ? mapped : mapped_type{};
+        }
+        out.m_codes = m_codes;
+        return out;
+    }
+
+    /**
+     * @brief Fails lanes whose value fn rejects.
+     *
+     * fn returns a Code: 0 accepts the value, anything else becomes the lane's error. Lanes that
+     * already failed keep their first error. Like map, fn runs on every lane.
+     */
+    template <typename Fn>
+    constexpr SimdResult& validate(Fn&& fn) {
+        for (std::size_t lane = 0; lane < N; ++lane) {
+            const auto code = static_cast<Code>(fn(std::as_const(m_values[lane])));
+            const bool fails = m_codes[lane] == ok_code && code != ok_code;
+            m_codes[lane] = fails ? code : m_codes[lane];
+            m_values[lane] = fails ? T{} : m_values[lane];
+        }
+        return *this;
+    }
+
+private:
+    template <typename, std::size_t, typename>
+    friend class SimdResult;
+
+    alignas(detail::simd_alignment<T, N>) std::array<T, N> m_values{};
+    alignas(detail::simd_alignment<Code, N>) std::array<Code, N> m_codes{};
+};
+
+}  // namespace feer
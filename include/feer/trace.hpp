@@ -0,0 +1,360 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace feer {
+
+/** @brief Kind of a recorded error event. */
+enum class ErrTraceEventKind : std::uint8_t {
+    created,
+    handled,
+};
+
+/** @brief One recorded error event. */
+struct ErrTraceEvent {
+    /** Raw timestamp counter value (see detail::read_ticks). */
+    std::uint64_t ticks;
+
+    /** Err::fingerprint() of the error. */
+    std::uint64_t fingerprint;
+
+    /** Construction site of the error. */
+    std::source_location where;
+
+    ErrTraceEventKind kind;
+
+    /** Operating system id of the recording thread. */
+    std::uint64_t tid;
+};
+
+namespace detail {
+
+inline std::uint64_t current_pid() noexcept {
+#if defined(_WIN32)
+    return static_cast<std::uint64_t>(_getpid());
+#else
+    return static_cast<std::uint64_t>(getpid());
+#endif
+}
+
+// Ids of other platforms are only unique within this process and do not match external tools.
+inline std::uint64_t current_tid() noexcept {
+#if defined(__linux__)
+    return static_cast<std::uint64_t>(syscall(SYS_gettid));
+#elif defined(__APPLE__)
+    std::uint64_t tid = 0;
+    pthread_threadid_np(nullptr, &tid);
+    return tid;
+#else
+    static std::atomic<std::uint64_t> next{1};
+    return next.fetch_add(1, std::memory_order_relaxed);
+#endif
+}
+
+/**
+ * Event buffer of one recording thread.
+ *
+ * Events are stored in blocks allocated as the buffer fills, so an idle thread costs a small
+ * table of block pointers. When its thread exits the buffer is released, keeps its events and is
+ * handed to the next new thread, which appends after them.
+ */
+struct ErrTraceBuffer {
+    static constexpr std::size_t block_events = 256;
+
+    explicit ErrTraceBuffer(std::size_t in_capacity)
+        : capacity(in_capacity),
+          blocks(std::make_unique<std::atomic<ErrTraceEvent*>[]>((in_capacity + block_events - 1) / block_events)) {}
+
+    ErrTraceBuffer(const ErrTraceBuffer&) = delete;
+    ErrTraceBuffer& operator=(const ErrTraceBuffer&) = delete;
+
+    ~ErrTraceBuffer() {
+        for (std::size_t i = 0; i < (capacity + block_events - 1) / block_events; ++i) {
+            delete[] blocks[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    // Only called by the owning thread.
+    void append(const ErrTraceEvent& event) {
+        const std::size_t index = size.load(std::memory_order_relaxed);
+        if (index >= capacity) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        std::atomic<ErrTraceEvent*>& block = blocks[index / block_events];
+        ErrTraceEvent* events = block.load(std::memory_order_relaxed);
+        if (events == nullptr) {
+            events = new ErrTraceEvent[block_events];
+            block.store(events, std::memory_order_relaxed);
+        }
+        events[index % block_events] = event;
+        size.store(index + 1, std::memory_order_release);
+    }
+
+    // Valid for index < size loaded with acquire.
+    const ErrTraceEvent& operator[](std::size_t index) const noexcept {
+        return blocks[index / block_events].load(std::memory_order_relaxed)[index % block_events];
+    }
+
+    const std::size_t capacity;
+    std::unique_ptr<std::atomic<ErrTraceEvent*>[]> blocks;
+    std::atomic<std::size_t> size{0};
+    std::atomic<std::uint64_t> dropped{0};
+    std::atomic<bool> in_use{true};
+};
+
+struct ErrTraceState {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ErrTraceBuffer>> buffers;
+    std::atomic<bool> active{false};
+    std::size_t capacity = 0;
+    std::uint64_t start_ticks = 0;
+    std::chrono::steady_clock::time_point start_time;
+    std::atomic<ErrHook> previous_created{nullptr};
+    std::atomic<ErrHook> previous_handled{nullptr};
+
+    ErrTraceBuffer* register_thread() {
+        const std::lock_guard lock{mutex};
+        for (const auto& buffer : buffers) {
+            if (buffer->capacity == capacity && buffer->size.load(std::memory_order_relaxed) < capacity &&
+                !buffer->in_use.load(std::memory_order_acquire)) {
+                buffer->in_use.store(true, std::memory_order_relaxed);
+                return buffer.get();
+            }
+        }
+        buffers.push_back(std::make_unique<ErrTraceBuffer>(capacity));
+        return buffers.back().get();
+    }
+};
+
+inline ErrTraceState& err_trace_state() {
+    static ErrTraceState state;
+    return state;
+}
+
+/** Per-thread recording state; releases the thread's buffer for reuse when the thread exits. */
+struct ErrTraceThread {
+    ErrTraceThread() = default;
+    ErrTraceThread(const ErrTraceThread&) = delete;
+    ErrTraceThread& operator=(const ErrTraceThread&) = delete;
+
+    ~ErrTraceThread() {
+        if (buffer != nullptr) {
+            buffer->in_use.store(false, std::memory_order_release);
+        }
+    }
+
+    ErrTraceBuffer* buffer = nullptr;
+    std::uint64_t tid = current_tid();
+};
+
+inline void record_err_event(ErrTraceEventKind kind, const Err& err) {
+    ErrTraceState& state = err_trace_state();
+    if (!state.active.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    thread_local ErrTraceThread self;
+    if (self.buffer == nullptr) {
+        self.buffer = state.register_thread();
+    }
+    self.buffer->append(ErrTraceEvent{read_ticks(), err.fingerprint(), err.where, kind, self.tid});
+}
+
+inline void trace_err_created(const Err& err) {
+    record_err_event(ErrTraceEventKind::created, err);
+    if (const ErrHook previous = err_trace_state().previous_created.load(std::memory_order_acquire)) {
+        previous(err);
+    }
+}
+
+inline void trace_err_handled(const Err& err) {
+    record_err_event(ErrTraceEventKind::handled, err);
+    if (const ErrHook previous = err_trace_state().previous_handled.load(std::memory_order_acquire)) {
+        previous(err);
+    }
+}
+
+/**
+ * Installs trace as hook, saving the hook it replaces in previous first, so a thread that calls
+ * trace as soon as it is installed already sees the hook to chain to. Does nothing when trace is
+ * already installed, which would make it chain to itself.
+ */
+inline void install_trace_hook(std::atomic<ErrHook>& hook, std::atomic<ErrHook>& previous, ErrHook trace) noexcept {
+    ErrHook current = hook.load(std::memory_order_acquire);
+    do {
+        if (current == trace) {
+            return;
+        }
+        previous.store(current, std::memory_order_release);
+    } while (!hook.compare_exchange_weak(current, trace, std::memory_order_acq_rel, std::memory_order_acquire));
+}
+
+/** Puts the saved hook back, unless a hook installed after trace has replaced it since. */
+inline void restore_trace_hook(std::atomic<ErrHook>& hook, std::atomic<ErrHook>& previous, ErrHook trace) noexcept {
+    ErrHook expected = trace;
+    hook.compare_exchange_strong(expected, previous.load(std::memory_order_acquire), std::memory_order_acq_rel);
+}
+
+inline void write_json_string(std::ostream& out, std::string_view text) {
+    out << '"';
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+            out << escaped;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+}  // namespace detail
+
+/**
+ * @brief Starts recording error creation and handling events.
+ *
+ * Installs the Err hooks (chaining to any hooks already installed). Each recording thread gets a
+ * buffer of up to events_per_thread events on its first event; storage is allocated in blocks as
+ * events arrive, and once full, further events on that thread are counted as dropped. Buffers of
+ * exited threads are handed to new threads, so thread churn does not grow the trace beyond the
+ * events it holds. Recording costs no locks after a thread's first event.
+ *
+ * @param events_per_thread Capacity of buffers handed out from now on.
+ */
+inline void start_err_trace(std::size_t events_per_thread = std::size_t{1} << 16) {
+    detail::ErrTraceState& state = detail::err_trace_state();
+    // Claims the session, so concurrent callers cannot both install the hooks.
+    if (state.active.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    {
+        const std::lock_guard lock{state.mutex};
+        state.capacity = events_per_thread;
+        state.start_ticks = detail::read_ticks();
+        state.start_time = std::chrono::steady_clock::now();
+    }
+    detail::install_trace_hook(detail::err_hook, state.previous_created, &detail::trace_err_created);
+    detail::install_trace_hook(detail::err_handled_hook, state.previous_handled, &detail::trace_err_handled);
+}
+
+/**
+ * @brief Stops recording and restores the previously installed Err hooks.
+ *
+ * A hook installed after start_err_trace() is left in place; it keeps whatever it chains to.
+ *
+ * Recorded events are kept until clear_err_trace().
+ */
+inline void stop_err_trace() {
+    detail::ErrTraceState& state = detail::err_trace_state();
+    if (!state.active.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    detail::restore_trace_hook(detail::err_hook, state.previous_created, &detail::trace_err_created);
+    detail::restore_trace_hook(detail::err_handled_hook, state.previous_handled, &detail::trace_err_handled);
+}
+
+/**
+ * @brief Discards all recorded events. Must not race with recording threads.
+ */
+inline void clear_err_trace() {
+    detail::ErrTraceState& state = detail::err_trace_state();
+    const std::lock_guard lock{state.mutex};
+    for (auto& buffer : state.buffers) {
+        buffer->size.store(0, std::memory_order_relaxed);
+        buffer->dropped.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Number of events dropped because a thread buffer was full.
+ */
+[[nodiscard]] inline std::uint64_t err_trace_dropped() {
+    detail::ErrTraceState& state = detail::err_trace_state();
+    const std::lock_guard lock{state.mutex};
+    std::uint64_t dropped = 0;
+    for (const auto& buffer : state.buffers) {
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+/**
+ * @brief Writes recorded events as Chrome Trace Event JSON, loadable in Perfetto and chrome://tracing.
+ *
+ * Events are instant events ("ph": "i") named err_created / err_handled. pid and tid are the
+ * operating system's process and thread ids (on Linux and macOS), and timestamps are microseconds
+ * on the std::chrono::steady_clock epoch, so events land on the same tracks as spans the
+ * application records for its threads.
+ */
+inline void write_chrome_trace(std::ostream& out) {
+    detail::ErrTraceState& state = detail::err_trace_state();
+    const std::lock_guard lock{state.mutex};
+
+    const auto pid = static_cast<unsigned long long>(detail::current_pid());
+
+    const std::uint64_t now_ticks = detail::read_ticks();
+    const auto now_time = std::chrono::steady_clock::now();
+    const double elapsed_us = std::chrono::duration<double, std::micro>(now_time - state.start_time).count();
+    const double elapsed_ticks = static_cast<double>(now_ticks - state.start_ticks);
+    const double us_per_tick = elapsed_ticks > 0.0 ? elapsed_us / elapsed_ticks : 0.0;
+    const double start_us = std::chrono::duration<double, std::micro>(state.start_time.time_since_epoch()).count();
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& buffer : state.buffers) {
+        const std::size_t size = buffer->size.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < size; ++i) {
+            const ErrTraceEvent& event = (*buffer)[i];
+            const double ts =
+                start_us + static_cast<double>(static_cast<std::int64_t>(event.ticks - state.start_ticks)) * us_per_tick;
+
+            char numbers[128];
+            std::snprintf(
+                numbers,
+                sizeof(numbers),
+                "\"ts\":%.3f,\"pid\":%llu,\"tid\":%llu,\"args\":{\"fingerprint\":\"0x%016llx\",\"line\":%u,",
+                ts,
+                pid,
+                static_cast<unsigned long long>(event.tid),
+                static_cast<unsigned long long>(event.fingerprint),
+                static_cast<unsigned>(event.where.line()));
+
+            out << (first ? "" : ",") << "{\"name\":\""
+                << (event.kind == ErrTraceEventKind::created ? "err_created" : "err_handled")
+                << "\",\"cat\":\"feer\",\"ph\":\"i\",\"s\":\"t\"," << numbers << "\"file\":";
+            detail::write_json_string(out, event.where.file_name());
+            out << ",\"function\":";
+            detail::write_json_string(out, event.where.function_name());
+            out << "}}";
+            first = false;
+        }
+    }
+    out << "]}";
+}
+
+}  // namespace feer
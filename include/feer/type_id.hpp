@@ -0,0 +1,27 @@
+#pragma once
+
+#include <feer/result.hpp>
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace feer {
+
+/**
+ * @brief Readable name of T as spelled by the compiler. Usable in constant expressions.
+ */
+template <typename T>
+inline constexpr std::string_view type_name = detail::type_name<std::remove_cv_t<T>>();
+
+/**
+ * @brief Stable 64-bit identity of T without RTTI. Usable in constant expressions; never 0.
+ *
+ * Hash of the compiler's name of T, so equal across translation units and shared libraries, and
+ * comparing two ids is one integer compare. Types named alike in different anonymous namespaces
+ * share an id; give types that cross translation units a real namespace.
+ */
+template <typename T>
+inline constexpr std::uint64_t type_id = detail::type_hash<T>;
+
+}  // namespace feer
@@ -1,54 +1,1803 @@
 module;
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <functional>
+#include <memory>
+#include <new>
 #include <source_location>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <variant>
 
+#if defined(__GNUC__) || defined(__clang__)
+#define FEER_COLD_NOINLINE [[gnu::cold, gnu::noinline]]
+#define FEER_NOINLINE [[gnu::noinline]]
+#elif defined(_MSC_VER)
+#define FEER_COLD_NOINLINE __declspec(noinline)
+#define FEER_NOINLINE __declspec(noinline)
+#else
+#define FEER_COLD_NOINLINE
+#define FEER_NOINLINE
+#endif
+
+/*
+ * Branch likelihood policy of Result state checks (match, value_or, special members).
+ *
+ *   FEER_BRANCH_HINTS_OK   (default) success is [[likely]]; Err construction and handling are cold.
+ *   FEER_BRANCH_HINTS_ERR  error is [[likely]], for code where failures are the common case.
+ *   FEER_BRANCH_HINTS_NONE no hints; the compiler's own heuristics (or PGO) decide.
+ */
+#define FEER_BRANCH_HINTS_NONE 0
+#define FEER_BRANCH_HINTS_OK 1
+#define FEER_BRANCH_HINTS_ERR 2
+
+#if !defined(FEER_BRANCH_HINTS)
+#define FEER_BRANCH_HINTS FEER_BRANCH_HINTS_OK
+#endif
+
+#if FEER_BRANCH_HINTS == FEER_BRANCH_HINTS_OK
+#define FEER_OK_BRANCH [[likely]]
+#define FEER_ERR_BRANCH [[unlikely]]
+#if defined(__GNUC__) || defined(__clang__)
+#define FEER_ERR_COLD [[gnu::cold]]
+#else
+#define FEER_ERR_COLD
+#endif
+#elif FEER_BRANCH_HINTS == FEER_BRANCH_HINTS_ERR
+#define FEER_OK_BRANCH [[unlikely]]
+#define FEER_ERR_BRANCH [[likely]]
+#define FEER_ERR_COLD
+#else
+#define FEER_OK_BRANCH
+#define FEER_ERR_BRANCH
+#define FEER_ERR_COLD
+#endif
+
+/*
+ * Debug-build performance mode, enabled with FEER_DEBUG_PERF=1 (meant for -O0 and /Od builds).
+ *
+ * Forces the accessors of Result to be inlined even when optimization is off, so value(), match()
+ * and friends cost about what a raw struct member access does instead of several call frames.
+ * MSVC only honours the forced inlining with /Ob1 or higher.
+ */
+#if !defined(FEER_DEBUG_PERF)
+#define FEER_DEBUG_PERF 0
+#endif
+
+#if FEER_DEBUG_PERF && (defined(__GNUC__) || defined(__clang__))
+#define FEER_ALWAYS_INLINE [[gnu::always_inline]]
+#elif FEER_DEBUG_PERF && defined(_MSC_VER)
+#define FEER_ALWAYS_INLINE [[msvc::forceinline]]
+#else
+#define FEER_ALWAYS_INLINE
+#endif
+
+/*
+ * Experimental C++23 explicit object parameters ("deducing this"), enabled with
+ * FEER_DEDUCING_THIS=1. value(), value_or() and match() are then each one function template
+ * forwarding *this instead of one overload per ref-qualifier, with the same behaviour. Off by
+ * default until feer_tests_cxx23 has run on a compiler that supports it.
+ */
+#if !defined(FEER_DEDUCING_THIS)
+#define FEER_DEDUCING_THIS 0
+#endif
+
+#if FEER_DEDUCING_THIS && !(defined(__cpp_explicit_this_parameter) && __cpp_explicit_this_parameter >= 202110L)
+#error "FEER_DEDUCING_THIS=1 requires C++23 explicit object parameters (GCC 14, Clang 19 or MSVC 17.2)"
+#endif
+
+/* std::move / std::forward as plain casts: no function call, even at -O0. */
+#define FEER_MOVE(...) static_cast<std::remove_reference_t<decltype((__VA_ARGS__))>&&>(__VA_ARGS__)
+#define FEER_FORWARD(...) static_cast<decltype(__VA_ARGS__)&&>(__VA_ARGS__)
+
+/*
+ * Optional USDT probes (provider "feer"), enabled with FEER_ENABLE_USDT=1.
+ *
+ * Emits the same .note.stapsdt records as <sys/sdt.h> without depending on it, so bpftrace,
+ * bcc and perf can attach to a running process. An unattached probe is a single nop.
+ * Every probe passes (const char* file, uint32 line, const char* message, const Err* err).
+ */
+#if !defined(FEER_ENABLE_USDT)
+#define FEER_ENABLE_USDT 0
+#endif
+
+#if FEER_ENABLE_USDT && defined(__ELF__) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__aarch64__))
+#define FEER_USDT_ARG(value) static_cast<std::uint64_t>((value))
+#define FEER_USDT_PROBE4(name, v1, v2, v3, v4)                                         \
+    __asm__ __volatile__(                                                              \
+        "990: nop\n"                                                                   \
+        ".pushsection .note.stapsdt,\"?\",\"note\"\n"                                   \
+        ".balign 4\n"                                                                  \
+        ".4byte 992f-991f, 994f-993f, 3\n"                                             \
+        "991: .asciz \"stapsdt\"\n"                                                    \
+        "992: .balign 4\n"                                                             \
+        "993: .8byte 990b\n"                                                           \
+        ".8byte _.stapsdt.base\n"                                                      \
+        ".8byte 0\n"                                                                   \
+        ".asciz \"feer\"\n"                                                            \
+        ".asciz \"" #name "\"\n"                                                       \
+        ".asciz \"8@%[a1] 8@%[a2] 8@%[a3] 8@%[a4]\"\n"                                 \
+        "994: .balign 4\n"                                                             \
+        ".popsection\n"                                                                \
+        ".ifndef _.stapsdt.base\n"                                                     \
+        ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"         \
+        ".weak _.stapsdt.base\n"                                                       \
+        ".hidden _.stapsdt.base\n"                                                     \
+        "_.stapsdt.base: .space 1\n"                                                   \
+        ".size _.stapsdt.base, 1\n"                                                    \
+        ".popsection\n"                                                                \
+        ".endif\n"                                                                     \
+        :                                                                              \
+        : [a1] "nor"(FEER_USDT_ARG(v1)), [a2] "nor"(FEER_USDT_ARG(v2)),                \
+          [a3] "nor"(FEER_USDT_ARG(v3)), [a4] "nor"(FEER_USDT_ARG(v4)))
+#define FEER_USDT_ERR_PROBE(name, err)                                                  \
+    FEER_USDT_PROBE4(                                                                  \
+        name,                                                                          \
+        reinterpret_cast<std::uintptr_t>((err).where.file_name()),                     \
+        (err).where.line(),                                                            \
+        reinterpret_cast<std::uintptr_t>((err).message.c_str()),                       \
+        reinterpret_cast<std::uintptr_t>(&(err)))
+#else
+#define FEER_USDT_ERR_PROBE(name, err) static_cast<void>(0)
+#endif
+
+/*
+ * Optional propagation metrics, enabled with FEER_PROPAGATION_METRICS=1.
+ *
+ * Stamps every Err with a timestamp counter value and counts its hops: each time it is placed into
+ * a Result and each time a failed Result is move-constructed, e.g. by `return result;`. Returns
+ * the compiler elides (a call returned directly, named return value optimization) create no new
+ * Result and are not counted, so the count is a lower bound on the frames crossed. Changes the
+ * layout of Err, so every translation unit must agree on the setting.
+ * Histograms are collected by feer/metrics.hpp.
+ */
+#if !defined(FEER_PROPAGATION_METRICS)
+#define FEER_PROPAGATION_METRICS 0
+#endif
+
+/*
+ * Optional typed error payloads, enabled with FEER_ERR_PAYLOADS=1.
+ *
+ * Adds Err::attach and Err::payload<T> for structured data such as an HTTP status or a retry
+ * delay. Payloads of up to 16 bytes are stored inside the Err, larger ones on the heap. Adds 24
+ * bytes to Err, so every translation unit must agree on the setting.
+ */
+#if !defined(FEER_ERR_PAYLOADS)
+#define FEER_ERR_PAYLOADS 0
+#endif
+
+/*
+ * Heap payloads come from per-thread free lists (see detail::ErrNodePool) instead of the global
+ * allocator. Define FEER_ERR_NODE_POOL=0 to allocate them with plain new and delete. Only payloads
+ * are pooled: a message longer than std::string's small buffer is still allocated with it.
+ */
+#if !defined(FEER_ERR_NODE_POOL)
+#define FEER_ERR_NODE_POOL 1
+#endif
+
+#if FEER_ERR_PAYLOADS && FEER_ERR_NODE_POOL
+#include <mutex>
+#endif
+
+/*
+ * Interned error messages, enabled with FEER_INTERN_MESSAGES=1.
+ *
+ * Err::message becomes a feer::InternedString: equal messages share one immutable, reference
+ * counted copy in a process-wide table, and comparing two messages is a pointer compare. Changes the
+ * type and size of Err, so every translation unit must agree on the setting.
+ */
+#if !defined(FEER_INTERN_MESSAGES)
+#define FEER_INTERN_MESSAGES 0
+#endif
+
+#if FEER_INTERN_MESSAGES
+#include <mutex>
+#include <unordered_map>
+#endif
+
+/*
+ * Automatic boxing of large success values, enabled with FEER_BOX_THRESHOLD=<bytes>.
+ *
+ * Result<T> with sizeof(T) above the threshold keeps T on the heap behind one pointer, so the
+ * Result is no larger than an Err and propagating it through many frames moves a pointer instead
+ * of the whole payload. feer::box_value<T> can be specialized to decide per type. Changes the
+ * layout of Result, so every translation unit must agree on the setting.
+ */
+#if !defined(FEER_BOX_THRESHOLD)
+#define FEER_BOX_THRESHOLD 0
+#endif
+
+#if FEER_BOX_THRESHOLD != 0 && FEER_BOX_THRESHOLD < 8
+#error "FEER_BOX_THRESHOLD must be 0 (disabled) or at least 8 bytes"
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+/*
+ * Optional unchecked-Result detection, enabled with FEER_CHECK_UNINSPECTED=1 (meant for debug builds).
+ *
+ * A Result that is destroyed while holding an error nobody looked at (is_ok, is_err, bool
+ * conversion, value, value_or, match or error) is reported with the error's location. Adds one
+ * flag to Result, so every translation unit must agree on the setting; when disabled the layout
+ * and generated code of Result are unchanged.
+ */
+#if !defined(FEER_CHECK_UNINSPECTED)
+#define FEER_CHECK_UNINSPECTED 0
+#endif
+
+/*
+ * Optional copy/move audit, enabled with FEER_AUDIT_COPIES=1 (meant for debug builds).
+ *
+ * Counts every copy and move of T and Err performed by a Result operation, keyed by the call site
+ * that constructed the Result (or called value_or), and prints a report to stderr at exit.
+ * Construction and value_or gain a defaulted std::source_location parameter, and Result remembers
+ * its construction site, so every translation unit must agree on the setting.
+ */
+#if !defined(FEER_AUDIT_COPIES)
+#define FEER_AUDIT_COPIES 0
+#endif
+
+#if FEER_AUDIT_COPIES
+#include <map>
+#include <mutex>
+#define FEER_AUDIT_SITE , std::source_location feer_audit_site = std::source_location::current()
+#define FEER_AUDIT_SITE_ONLY std::source_location feer_audit_site = std::source_location::current()
+#define FEER_AUDIT_ARGS(...) __VA_ARGS__, feer_audit_site
+#else
+#define FEER_AUDIT_SITE
+#define FEER_AUDIT_SITE_ONLY
+#define FEER_AUDIT_ARGS(...) __VA_ARGS__
+#endif
+
 export module feer.result;
 
-export namespace feer {
+export namespace feer {
+
+struct Err;
+
+/**
+ * @brief Observer invoked for every explicitly constructed Err.
+ *
+ * Called on the constructing thread; must be thread-safe.
+ */
+using ErrHook = void (*)(const Err& err);
+
+namespace detail {
+
+inline std::atomic<ErrHook> err_hook{nullptr};
+inline std::atomic<ErrHook> err_handled_hook{nullptr};
+inline std::atomic<ErrHook> uninspected_err_hook{nullptr};
+
+#if FEER_PROPAGATION_METRICS
+inline std::atomic<ErrHook> propagation_observer{nullptr};
+#endif
+
+/** Raw timestamp counter: TSC on x86, CNTVCT on AArch64, steady_clock nanoseconds elsewhere. */
+[[nodiscard]] inline std::uint64_t read_ticks() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_ia32_rdtsc();
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+    std::uint64_t ticks;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+#endif
+}
+
+inline constexpr std::uint64_t fnv_offset_basis = 0xcbf29ce484222325ULL;
+inline constexpr std::uint64_t fnv_prime = 0x100000001b3ULL;
+
+[[nodiscard]] constexpr std::uint64_t fnv1a(std::string_view bytes, std::uint64_t hash = fnv_offset_basis) noexcept {
+    for (const char c : bytes) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= fnv_prime;
+    }
+    return hash;
+}
+
+[[nodiscard]] constexpr std::uint64_t fnv1a(std::uint64_t value, std::uint64_t hash) noexcept {
+    for (int i = 0; i < 8; ++i) {
+        hash ^= (value >> (i * 8)) & 0xffU;
+        hash *= fnv_prime;
+    }
+    return hash;
+}
+
+/** Human-readable name of T, extracted from the compiler's pretty function signature. */
+template <typename T>
+[[nodiscard]] constexpr std::string_view type_name() noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+    constexpr std::string_view signature = __PRETTY_FUNCTION__;
+    constexpr std::size_t begin = signature.find("T = ") + 4;
+    constexpr std::size_t end = signature.find_first_of(";]", begin);
+    return signature.substr(begin, end - begin);
+#elif defined(_MSC_VER)
+    constexpr std::string_view signature = __FUNCSIG__;
+    constexpr std::size_t begin = signature.find("type_name<") + 10;
+    constexpr std::size_t end = signature.rfind(">(void)");
+    return signature.substr(begin, end - begin);
+#else
+    return "?";
+#endif
+}
+
+/** 64-bit hash of type_name<T>(), never 0. See feer::type_id. */
+template <typename T>
+inline constexpr std::uint64_t type_hash = [] {
+    const std::uint64_t hash = fnv1a(type_name<std::remove_cv_t<T>>());
+    return hash != 0 ? hash : 1;
+}();
+
+}  // namespace detail
+
+/**
+ * @brief Stable 64-bit identity of an error class: its construction site.
+ *
+ * Hashes file, function, line and column, not the message, so errors whose messages embed
+ * dynamic content (peer addresses, ids) still share one identity per site.
+ * Usable in constant expressions, so literal call sites can be folded at compile time.
+ * Never returns 0.
+ */
+[[nodiscard]] constexpr std::uint64_t fingerprint(const std::source_location& where) noexcept {
+    std::uint64_t hash = detail::fnv1a(std::string_view{where.file_name()});
+    hash = detail::fnv1a(std::string_view{where.function_name()}, hash);
+    hash = detail::fnv1a((static_cast<std::uint64_t>(where.line()) << 32) | where.column(), hash);
+    return hash != 0 ? hash : 1;
+}
+
+/**
+ * @brief Identity of an error class keyed by its site and a caller-supplied key.
+ *
+ * key is a message template or an error code name, e.g. "connection reset by peer: {}", for
+ * sites that raise several kinds of errors. Never returns 0.
+ */
+[[nodiscard]] constexpr std::uint64_t fingerprint(const std::source_location& where, std::string_view key) noexcept {
+    const std::uint64_t hash = detail::fnv1a(key, fingerprint(where));
+    return hash != 0 ? hash : 1;
+}
+
+#if FEER_INTERN_MESSAGES
+namespace detail {
+
+struct InternedEntry {
+    std::string text;
+    std::uint64_t hash;
+    mutable std::atomic<std::size_t> refs{1};
+};
+
+/**
+ * Process-wide set of interned messages.
+ *
+ * Split into stripes, each with its own lock, picked by the message hash, so threads interning
+ * different messages rarely contend. Every handle holds a reference to its entry and the entry is
+ * removed when the last one is released, so one-off messages do not accumulate.
+ */
+class InternTable {
+public:
+    static constexpr std::size_t stripe_count = 64;
+
+    // Never destroyed: errors may still refer to entries from other static destructors.
+    static InternTable& instance() {
+        static InternTable* const table = new InternTable;
+        return *table;
+    }
+
+    /** Returns the entry for text with one more reference, creating it if needed. */
+    const InternedEntry* intern(std::string_view text) {
+        const std::uint64_t hash = fnv1a(text);
+        Stripe& stripe = m_stripes[hash % stripe_count];
+        const std::lock_guard lock{stripe.mutex};
+
+        const auto [first, last] = stripe.entries.equal_range(hash);
+        for (auto it = first; it != last; ++it) {
+            if (it->second->text == text) {
+                it->second->refs.fetch_add(1, std::memory_order_relaxed);
+                return it->second.get();
+            }
+        }
+        auto entry = std::unique_ptr<InternedEntry>(new InternedEntry{std::string{text}, hash});
+        return stripe.entries.emplace(hash, std::move(entry))->second.get();
+    }
+
+    /**
+     * Drops one reference to entry and removes it when none are left.
+     *
+     * An entry that dropped to zero may be handed out again by intern() before the lock is taken,
+     * so it is only erased if it is still in the table and still unreferenced under the lock; the
+     * entry itself is not touched after the decrement.
+     */
+    void release(const InternedEntry* entry) noexcept {
+        const std::uint64_t hash = entry->hash;
+        if (entry->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+        Stripe& stripe = m_stripes[hash % stripe_count];
+        const std::lock_guard lock{stripe.mutex};
+
+        const auto [first, last] = stripe.entries.equal_range(hash);
+        for (auto it = first; it != last; ++it) {
+            if (it->second.get() == entry) {
+                if (it->second->refs.load(std::memory_order_acquire) == 0) {
+                    stripe.entries.erase(it);
+                }
+                return;
+            }
+        }
+    }
+
+    /** Number of distinct interned messages. */
+    std::size_t size() {
+        std::size_t total = 0;
+        for (Stripe& stripe : m_stripes) {
+            const std::lock_guard lock{stripe.mutex};
+            total += stripe.entries.size();
+        }
+        return total;
+    }
+
+private:
+    struct alignas(64) Stripe {
+        std::mutex mutex;
+        std::unordered_multimap<std::uint64_t, std::unique_ptr<InternedEntry>> entries;
+    };
+
+    InternTable() = default;
+
+    Stripe m_stripes[stripe_count];
+};
+
+}  // namespace detail
+
+/**
+ * @brief Handle to an immutable message in the process-wide intern table.
+ *
+ * Constructing one looks the text up (one lock out of 64, picked by hash) and stores a pointer to
+ * the shared copy. Copies are a pointer copy plus a reference count increment, moves are pointer
+ * moves and comparing two handles is a pointer compare. The text is freed with its last handle.
+ * During constant evaluation the handle owns a private copy instead, so compile-time Results still
+ * work.
+ */
+class InternedString {
+public:
+    /** Empty string. */
+    constexpr InternedString() noexcept = default;
+
+    /** Interns text. */
+    constexpr explicit InternedString(std::string_view text) {
+        if (std::is_constant_evaluated()) {
+            m_entry = new detail::InternedEntry{std::string{text}, detail::fnv1a(text)};
+            m_owned = true;
+            return;
+        }
+        m_entry = detail::InternTable::instance().intern(text);
+    }
+
+    /** Interns text. */
+    constexpr explicit InternedString(const char* text) : InternedString(std::string_view{text}) {}
+
+    /** Interns text. */
+    constexpr explicit InternedString(const std::string& text) : InternedString(std::string_view{text}) {}
+
+    constexpr InternedString(const InternedString& other) : m_entry(other.m_entry), m_owned(other.m_owned) {
+        if (m_owned) {
+            m_entry = new detail::InternedEntry{other.m_entry->text, other.m_entry->hash};
+        } else if (m_entry != nullptr) {
+            m_entry->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    constexpr InternedString(InternedString&& other) noexcept
+        : m_entry(std::exchange(other.m_entry, nullptr)), m_owned(std::exchange(other.m_owned, false)) {}
+
+    constexpr InternedString& operator=(InternedString other) noexcept {
+        std::swap(m_entry, other.m_entry);
+        std::swap(m_owned, other.m_owned);
+        return *this;
+    }
+
+    constexpr ~InternedString() {
+        if (m_owned) {
+            delete m_entry;
+        } else if (m_entry != nullptr) {
+            detail::InternTable::instance().release(m_entry);
+        }
+    }
+
+    /** @brief The interned text. */
+    [[nodiscard]] constexpr std::string_view view() const noexcept {
+        return m_entry != nullptr ? std::string_view{m_entry->text} : std::string_view{};
+    }
+
+    /** @brief The interned text. */
+    [[nodiscard]] constexpr const std::string& str() const noexcept {
+        return m_entry != nullptr ? m_entry->text : empty_text();
+    }
+
+    [[nodiscard]] constexpr const char* c_str() const noexcept { return m_entry != nullptr ? m_entry->text.c_str() : ""; }
+    [[nodiscard]] constexpr const char* data() const noexcept { return c_str(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return view().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return view().empty(); }
+
+    constexpr operator const std::string&() const noexcept { return str(); }
+    constexpr operator std::string_view() const noexcept { return view(); }
+
+    /** @brief Hash of the text, computed once when it was interned. */
+    [[nodiscard]] constexpr std::uint64_t hash() const noexcept {
+        return m_entry != nullptr ? m_entry->hash : detail::fnv1a({});
+    }
+
+    /** @brief Equal text. A pointer compare unless either side was built at compile time. */
+    friend constexpr bool operator==(const InternedString& lhs, const InternedString& rhs) noexcept {
+        if (lhs.m_entry == rhs.m_entry) {
+            return true;
+        }
+        if (!lhs.m_owned && !rhs.m_owned && lhs.m_entry != nullptr && rhs.m_entry != nullptr) {
+            return false;
+        }
+        return lhs.view() == rhs.view();
+    }
+
+    friend constexpr bool operator==(const InternedString& lhs, std::string_view rhs) noexcept {
+        return lhs.view() == rhs;
+    }
+
+    friend constexpr std::string operator+(std::string lhs, const InternedString& rhs) {
+        lhs += rhs.view();
+        return lhs;
+    }
+
+    friend constexpr std::string operator+(const InternedString& lhs, std::string_view rhs) {
+        std::string out{lhs.view()};
+        out += rhs;
+        return out;
+    }
+
+    /** @brief Number of distinct messages currently interned by the process. */
+    [[nodiscard]] static std::size_t table_size() { return detail::InternTable::instance().size(); }
+
+private:
+    static const std::string& empty_text() noexcept {
+        static const std::string text;
+        return text;
+    }
+
+    const detail::InternedEntry* m_entry = nullptr;
+    bool m_owned = false;
+};
+#endif
+
+#if FEER_ERR_PAYLOADS
+namespace detail {
+
+#if FEER_ERR_NODE_POOL
+/**
+ * Recycling allocator for out-of-line error payloads. Err::message is not served from here.
+ *
+ * Nodes come in four size classes (32 to 256 bytes) and each thread keeps up to 64 free nodes per
+ * class, so an error storm reuses the same few nodes without touching the global allocator. Every
+ * node records the cache it came from. A node freed by another thread is not cached there: the
+ * freeing thread collects up to 32 nodes for the same owner and hands them back with a single
+ * atomic splice, and the owner takes the whole returned list in one exchange when it runs out,
+ * keeping up to 64 of those nodes and freeing the rest.
+ * Caches of exited threads are kept, with whatever nodes are still returned to them, and adopted
+ * by the next new thread, so the number of caches is bounded by the peak thread count.
+ */
+class ErrNodePool {
+public:
+    static constexpr std::size_t class_count = 4;
+    static constexpr std::size_t smallest_node = 32;
+    static constexpr std::size_t max_cached = 64;
+    static constexpr std::size_t return_batch = 32;
+
+    /** True when nodes of this size and alignment come from the pool. */
+    static constexpr bool pooled(std::size_t size, std::size_t align) noexcept {
+        return size <= (smallest_node << (class_count - 1)) && align <= alignof(Header);
+    }
+
+    static void* allocate(std::size_t size) {
+        const std::size_t size_class = class_of(size);
+        Local* local_state = local();
+        if (local_state == nullptr) [[unlikely]] {
+            auto* node = static_cast<Header*>(::operator new(sizeof(Header) + node_size(size_class)));
+            node->owner = nullptr;
+            return node + 1;
+        }
+        Cache& cache = *local_state->cache;
+
+        Header* node = cache.free[size_class];
+        if (node == nullptr) {
+            node = take_returned(cache, size_class);
+        }
+        if (node == nullptr) {
+            node = static_cast<Header*>(::operator new(sizeof(Header) + node_size(size_class)));
+            node->owner = &cache;
+            return node + 1;
+        }
+        cache.free[size_class] = node->next;
+        --cache.free_count[size_class];
+        return node + 1;
+    }
+
+    /** Free nodes this thread holds for the size class of size. */
+    static std::size_t cached(std::size_t size) noexcept {
+        Local* local_state = local();
+        return local_state != nullptr ? local_state->cache->free_count[class_of(size)] : 0;
+    }
+
+    static void deallocate(void* ptr, std::size_t size) noexcept {
+        const std::size_t size_class = class_of(size);
+        Header* node = static_cast<Header*>(ptr) - 1;
+        Local* local_state = local();
+
+        if (node->owner == nullptr) [[unlikely]] {
+            ::operator delete(node);
+            return;
+        }
+        if (local_state == nullptr) [[unlikely]] {
+            // This thread's cache is gone (thread_local destruction); hand the node straight back.
+            Batch single{node->owner, size_class, node, node, 1};
+            single.flush();
+            return;
+        }
+        if (node->owner == local_state->cache) {
+            Cache& cache = *local_state->cache;
+            if (cache.free_count[size_class] >= max_cached) {
+                ::operator delete(node);
+                return;
+            }
+            node->next = cache.free[size_class];
+            cache.free[size_class] = node;
+            ++cache.free_count[size_class];
+            return;
+        }
+
+        Batch& batch = local_state->batch;
+        if (batch.count != 0 && (batch.owner != node->owner || batch.size_class != size_class)) {
+            batch.flush();
+        }
+        if (batch.count == 0) {
+            batch.owner = node->owner;
+            batch.size_class = size_class;
+            batch.tail = node;
+        }
+        node->next = batch.head;
+        batch.head = node;
+        if (++batch.count == return_batch) {
+            batch.flush();
+        }
+    }
+
+private:
+    struct Cache;
+
+    struct alignas(16) Header {
+        Cache* owner;
+        Header* next;
+    };
+
+    struct Cache {
+        Header* free[class_count]{};
+        std::size_t free_count[class_count]{};
+        std::atomic<Header*> returned[class_count]{};
+        Cache* next_retired = nullptr;
+    };
+
+    struct Batch {
+        Cache* owner = nullptr;
+        std::size_t size_class = 0;
+        Header* head = nullptr;
+        Header* tail = nullptr;
+        std::size_t count = 0;
+
+        void flush() noexcept {
+            if (count == 0) {
+                return;
+            }
+            std::atomic<Header*>& returned = owner->returned[size_class];
+            Header* expected = returned.load(std::memory_order_relaxed);
+            do {
+                tail->next = expected;
+            } while (!returned.compare_exchange_weak(
+                expected, head, std::memory_order_release, std::memory_order_relaxed));
+            head = nullptr;
+            tail = nullptr;
+            count = 0;
+        }
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        Cache* retired = nullptr;
+    };
+
+    struct Local {
+        Cache* cache;
+        Batch batch;
+
+        Local() : cache(adopt()) {}
+
+        ~Local() {
+            torn_down = true;
+            batch.flush();
+            for (std::size_t size_class = 0; size_class < class_count; ++size_class) {
+                while (Header* node = cache->free[size_class]) {
+                    cache->free[size_class] = node->next;
+                    ::operator delete(node);
+                }
+                cache->free_count[size_class] = 0;
+            }
+            Registry& reg = registry();
+            const std::lock_guard lock{reg.mutex};
+            cache->next_retired = reg.retired;
+            reg.retired = cache;
+        }
+    };
+
+    static constexpr std::size_t node_size(std::size_t size_class) noexcept { return smallest_node << size_class; }
+
+    // Adopts the nodes other threads returned as the free list, keeping at most max_cached of them.
+    // Only the kept prefix is walked; the surplus is released.
+    static Header* take_returned(Cache& cache, std::size_t size_class) noexcept {
+        Header* const head = cache.returned[size_class].exchange(nullptr, std::memory_order_acquire);
+        std::size_t count = 0;
+        Header* last = nullptr;
+        for (Header* it = head; it != nullptr && count < max_cached; it = it->next) {
+            last = it;
+            ++count;
+        }
+        if (last != nullptr) {
+            Header* surplus = std::exchange(last->next, nullptr);
+            while (surplus != nullptr) {
+                ::operator delete(std::exchange(surplus, surplus->next));
+            }
+        }
+        cache.free_count[size_class] = count;
+        return head;
+    }
+
+    static constexpr std::size_t class_of(std::size_t size) noexcept {
+        std::size_t size_class = 0;
+        while (node_size(size_class) < size) {
+            ++size_class;
+        }
+        return size_class;
+    }
+
+    // Never destroyed: threads may retire their caches after static destruction has begun.
+    static Registry& registry() {
+        static Registry* const instance = new Registry;
+        return *instance;
+    }
+
+    static Cache* adopt() {
+        Registry& reg = registry();
+        const std::lock_guard lock{reg.mutex};
+        if (Cache* cache = reg.retired) {
+            reg.retired = cache->next_retired;
+            cache->next_retired = nullptr;
+            return cache;
+        }
+        return new Cache;
+    }
+
+    // Null once this thread's state has been destroyed, e.g. for errors freed by later thread_local destructors.
+    static Local* local() {
+        if (torn_down) [[unlikely]] {
+            return nullptr;
+        }
+        thread_local Local state;
+        return &state;
+    }
+
+    static inline thread_local bool torn_down = false;
+};
+#endif
+
+/** Typed value attached to an Err: stored inline when small, otherwise on the heap. */
+class ErrPayload {
+public:
+    static constexpr std::size_t inline_capacity = 16;
+
+    constexpr ErrPayload() noexcept = default;
+
+    constexpr ErrPayload(const ErrPayload& other) {
+        if (other.m_ops != nullptr) {
+            other.m_ops->copy(other, *this);
+            m_ops = other.m_ops;
+        }
+    }
+
+    constexpr ErrPayload(ErrPayload&& other) noexcept { take(other); }
+
+    constexpr ErrPayload& operator=(const ErrPayload& other) {
+        if (this != &other) {
+            ErrPayload copy{other};
+            reset();
+            take(copy);
+        }
+        return *this;
+    }
+
+    constexpr ErrPayload& operator=(ErrPayload&& other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    constexpr ~ErrPayload() { reset(); }
+
+    /**
+     * Replaces the payload with value. The new payload is built before the old one is released, so
+     * value may refer into the current payload, and a throwing constructor leaves it unchanged.
+     */
+    template <typename T>
+    void emplace(T&& value) {
+        using V = std::remove_cvref_t<T>;
+        static_assert(std::is_copy_constructible_v<V>, "Err payloads must be copy constructible, like Err itself");
+
+        ErrPayload fresh;
+        if constexpr (stored_inline<V>) {
+            ::new (static_cast<void*>(fresh.m_buffer)) V(FEER_FORWARD(value));
+        } else {
+            ::new (static_cast<void*>(fresh.m_buffer)) V*(make_node<V>(FEER_FORWARD(value)));
+        }
+        fresh.m_ops = &ops_for<V>;
+        reset();
+        take(fresh);
+    }
+
+    template <typename T>
+    [[nodiscard]] const T* get() const noexcept {
+        using V = std::remove_cv_t<T>;
+        // Another shared library may hold its own ops_for<V>; then fall back to the type's id and name.
+        if (m_ops != &ops_for<V> &&
+            (m_ops == nullptr || m_ops->type != type_hash<V> || m_ops->name != type_name<V>())) {
+            return nullptr;
+        }
+        return &Access<std::remove_cv_t<T>>::get(const_cast<ErrPayload&>(*this));
+    }
+
+    [[nodiscard]] constexpr bool has_value() const noexcept { return m_ops != nullptr; }
+
+    constexpr void reset() noexcept {
+        if (m_ops != nullptr) {
+            m_ops->destroy(*this);
+            m_ops = nullptr;
+        }
+    }
+
+private:
+    // One instance per payload type (per shared library); its address identifies the type.
+    struct Ops {
+        std::uint64_t type;
+        std::string_view name;
+        void (*copy)(const ErrPayload& from, ErrPayload& to);
+        void (*relocate)(ErrPayload& from, ErrPayload& to) noexcept;
+        void (*destroy)(ErrPayload& payload) noexcept;
+    };
+
+    template <typename V>
+    static constexpr bool stored_inline =
+        sizeof(V) <= inline_capacity && alignof(V) <= alignof(void*) && std::is_nothrow_move_constructible_v<V>;
+
+    template <typename V>
+    struct Access {
+        static V& get(ErrPayload& payload) noexcept {
+            if constexpr (stored_inline<V>) {
+                return *std::launder(reinterpret_cast<V*>(payload.m_buffer));
+            } else {
+                return **std::launder(reinterpret_cast<V**>(payload.m_buffer));
+            }
+        }
+
+        static void copy(const ErrPayload& from, ErrPayload& to) {
+            const V& value = get(const_cast<ErrPayload&>(from));
+            if constexpr (stored_inline<V>) {
+                ::new (static_cast<void*>(to.m_buffer)) V(value);
+            } else {
+                ::new (static_cast<void*>(to.m_buffer)) V*(make_node<V>(value));
+            }
+        }
+
+        static void relocate(ErrPayload& from, ErrPayload& to) noexcept {
+            if constexpr (stored_inline<V>) {
+                ::new (static_cast<void*>(to.m_buffer)) V(FEER_MOVE(get(from)));
+                std::destroy_at(&get(from));
+            } else {
+                ::new (static_cast<void*>(to.m_buffer)) V*(&get(from));
+            }
+        }
+
+        static void destroy(ErrPayload& payload) noexcept {
+            if constexpr (stored_inline<V>) {
+                std::destroy_at(&get(payload));
+            } else {
+                drop_node(&get(payload));
+            }
+        }
+    };
+
+    template <typename V, typename Arg>
+    static V* make_node(Arg&& arg) {
+#if FEER_ERR_NODE_POOL
+        if constexpr (ErrNodePool::pooled(sizeof(V), alignof(V))) {
+            void* node = ErrNodePool::allocate(sizeof(V));
+            try {
+                return ::new (node) V(FEER_FORWARD(arg));
+            } catch (...) {
+                ErrNodePool::deallocate(node, sizeof(V));
+                throw;
+            }
+        }
+#endif
+        return new V(FEER_FORWARD(arg));
+    }
+
+    template <typename V>
+    static void drop_node(V* node) noexcept {
+#if FEER_ERR_NODE_POOL
+        if constexpr (ErrNodePool::pooled(sizeof(V), alignof(V))) {
+            std::destroy_at(node);
+            ErrNodePool::deallocate(node, sizeof(V));
+            return;
+        }
+#endif
+        delete node;
+    }
+
+    template <typename V>
+    static constexpr Ops ops_for{
+        type_hash<V>, type_name<V>(), &Access<V>::copy, &Access<V>::relocate, &Access<V>::destroy};
+
+    constexpr void take(ErrPayload& other) noexcept {
+        if (other.m_ops != nullptr) {
+            other.m_ops->relocate(other, *this);
+            m_ops = std::exchange(other.m_ops, nullptr);
+        }
+    }
+
+    const Ops* m_ops = nullptr;
+    alignas(void*) unsigned char m_buffer[inline_capacity];
+};
+
+}  // namespace detail
+#endif
+
+/**
+ * @brief Error payload used by feer::Result.
+ *
+ * Keeps a human-readable message and source location of construction.
+ */
+struct Err {
+    /** Human-readable error message. */
+#if FEER_INTERN_MESSAGES
+    InternedString message;
+#else
+    std::string message;
+#endif
+
+    /** Source location captured at error construction time. */
+    std::source_location where = std::source_location::current();
+
+#if FEER_PROPAGATION_METRICS
+    /** Timestamp counter value at construction (see detail::read_ticks); 0 when constructed at compile time. */
+    std::uint64_t created_ticks = 0;
+
+    /**
+     * Number of times this error has been placed into a Result or moved into a new one. Every move
+     * counts, including ones that only relocate a Result, such as std::vector growth.
+     */
+    std::uint32_t propagation_hops = 0;
+#endif
+
+    /**
+     * @brief Constructs an Err.
+     * @param in_message Error message.
+     * @param in_where Source location for diagnostics.
+     */
+    FEER_ERR_COLD constexpr explicit Err(
+        std::string in_message,
+        std::source_location in_where = std::source_location::current());
+
+    /** @brief Stable identity of this error's site. See feer::fingerprint. */
+    [[nodiscard]] constexpr std::uint64_t fingerprint() const noexcept { return feer::fingerprint(where); }
+
+#if FEER_ERR_PAYLOADS
+    /**
+     * @brief Attaches value as this error's typed payload, replacing any previous one.
+     *
+     * Values of up to 16 bytes are stored inline; larger ones are allocated. Must be copy constructible.
+     * @return *this, so the payload can be attached where the error is returned.
+     */
+    template <typename T>
+    Err& attach(T&& value) & {
+        m_payload.emplace(FEER_FORWARD(value));
+        return *this;
+    }
+
+    /** @copydoc attach */
+    template <typename T>
+    Err&& attach(T&& value) && {
+        m_payload.emplace(FEER_FORWARD(value));
+        return FEER_MOVE(*this);
+    }
+
+    /**
+     * @brief The attached payload if it is a T, else nullptr.
+     *
+     * Checked by comparing the address of a static per-type table, or the type's feer::type_id and name
+     * for a payload attached in another shared library, so no RTTI or dynamic_cast is involved.
+     */
+    template <typename T>
+    [[nodiscard]] const T* payload() const noexcept {
+        return m_payload.get<T>();
+    }
+
+    /** @brief True when a payload is attached. */
+    [[nodiscard]] constexpr bool has_payload() const noexcept { return m_payload.has_value(); }
+
+    /** @brief Destroys the attached payload, if any. */
+    constexpr void clear_payload() noexcept { m_payload.reset(); }
+
+private:
+    detail::ErrPayload m_payload;
+#endif
+};
+
+namespace detail {
+
+/** Out-of-line observation points, kept off the inline paths of Err and Result. */
+struct ErrEvents {
+    FEER_COLD_NOINLINE static void created(const Err& err) {
+        if (const ErrHook hook = err_hook.load(std::memory_order_acquire)) {
+            hook(err);
+        }
+    }
+
+    FEER_COLD_NOINLINE static void handled(const Err& err) {
+        if (const ErrHook hook = err_handled_hook.load(std::memory_order_acquire)) {
+            hook(err);
+        }
+    }
+
+    FEER_COLD_NOINLINE static void uninspected(const Err& err) {
+        if (const ErrHook hook = uninspected_err_hook.load(std::memory_order_acquire)) {
+            hook(err);
+            return;
+        }
+        std::fprintf(
+            stderr,
+            "feer: Result destroyed without inspecting its error: %s:%u: %s\n",
+            err.where.file_name(),
+            static_cast<unsigned>(err.where.line()),
+            err.message.c_str());
+    }
+
+#if FEER_PROPAGATION_METRICS
+    FEER_COLD_NOINLINE static void measured(const Err& err) {
+        if (const ErrHook observer = propagation_observer.load(std::memory_order_acquire)) {
+            observer(err);
+        }
+    }
+#endif
+};
+
+}  // namespace detail
+
+constexpr Err::Err(std::string in_message, std::source_location in_where) : where(in_where) {
+#if FEER_INTERN_MESSAGES
+    message = InternedString{in_message};
+    if (std::is_constant_evaluated()) {
+        return;
+    }
+#else
+    if (std::is_constant_evaluated()) {
+        // Copied: GCC 12 mis-evaluates moving out of a by-value std::string parameter in constant expressions.
+        message = in_message;
+        return;
+    }
+    message = std::move(in_message);
+#endif
+#if FEER_PROPAGATION_METRICS
+    created_ticks = detail::read_ticks();
+#endif
+    FEER_USDT_ERR_PROBE(err_created, *this);
+    if (detail::err_hook.load(std::memory_order_relaxed) != nullptr) [[unlikely]] {
+        detail::ErrEvents::created(*this);
+    }
+}
+
+/**
+ * @brief Installs a global hook observing every Err construction.
+ *
+ * While no hook is installed, constructing an Err costs one relaxed load and a predicted branch.
+ *
+ * @param hook New hook, or nullptr to uninstall.
+ * @return Previously installed hook.
+ */
+inline ErrHook set_err_hook(ErrHook hook) noexcept {
+    return detail::err_hook.exchange(hook, std::memory_order_acq_rel);
+}
+
+/**
+ * @brief Installs a global hook observing every handled Err.
+ *
+ * An error counts as handled when `match` takes its error branch or `value_or` falls back.
+ * Same cost model as set_err_hook.
+ *
+ * @param hook New hook, or nullptr to uninstall.
+ * @return Previously installed hook.
+ */
+inline ErrHook set_err_handled_hook(ErrHook hook) noexcept {
+    return detail::err_handled_hook.exchange(hook, std::memory_order_acq_rel);
+}
+
+/**
+ * @brief Installs the handler for Results destroyed with an uninspected error.
+ *
+ * Only used with FEER_CHECK_UNINSPECTED=1. The default handler prints the error to stderr.
+ *
+ * @param hook New handler, or nullptr to restore the default.
+ * @return Previously installed handler.
+ */
+inline ErrHook set_uninspected_err_hook(ErrHook hook) noexcept {
+    return detail::uninspected_err_hook.exchange(hook, std::memory_order_acq_rel);
+}
+
+namespace detail {
+
+/**
+ * Bad-access paths of every Result instantiation.
+ *
+ * Non-template and out of line, so all Result<T> share one copy of the throw or abort instead of
+ * emitting it per instantiation.
+ */
+struct ErrOps {
+    [[noreturn]] FEER_COLD_NOINLINE static void bad_access() { throw std::bad_variant_access{}; }
+
+    [[noreturn]] FEER_COLD_NOINLINE static void abort_access() noexcept {
+        std::fputs("feer: Result accessed in the wrong state\n", stderr);
+        std::abort();
+    }
+};
+
+}  // namespace detail
+
+/** @brief Where a BasicResult keeps its success value. */
+enum class ValueStorage : std::uint8_t {
+    /** Inline, or boxed when feer::box_value<T> (see FEER_BOX_THRESHOLD). */
+    automatic,
+    /** Always inline, whatever its size. */
+    inline_value,
+    /** Always on the heap behind one pointer. */
+    boxed,
+};
+
+/** @brief What a BasicResult does when value() or error() is called in the wrong state. */
+enum class AccessCheck : std::uint8_t {
+    /** Throw std::bad_variant_access. */
+    throws,
+    /** Print a message and call std::abort(), for builds without exceptions. */
+    aborts,
+    /** No check; the caller guarantees the state, as with operator* of std::optional. */
+    unchecked,
+};
+
+struct DefaultPolicy;
+
+/**
+ * @brief True when Result<T> keeps its T on the heap. See FEER_BOX_THRESHOLD.
+ *
+ * Specialize to box or unbox a type regardless of its size.
+ */
+template <typename T>
+inline constexpr bool box_value = FEER_BOX_THRESHOLD != 0 && sizeof(T) > FEER_BOX_THRESHOLD;
+
+namespace detail {
+
+/**
+ * Uniquely owned heap copy of a V, holding the success value of Results selected by box_value.
+ *
+ * Copies copy the V; moves transfer the pointer and leave the source empty. Copying an empty box
+ * gives an empty box. get() requires !empty(). A moved-from boxed Result stays ok: value_or()
+ * returns its fallback, while value() and match() report the empty box under the access policy,
+ * like any other invalid access, before any handler runs.
+ */
+template <typename V>
+class Boxed {
+public:
+    template <typename Arg>
+        requires(!std::is_same_v<std::remove_cvref_t<Arg>, Boxed>)
+    constexpr explicit Boxed(Arg&& arg) : m_ptr(new V(FEER_FORWARD(arg))) {}
+
+    constexpr Boxed(const Boxed& other) requires(std::is_copy_constructible_v<V>)
+        : m_ptr(other.m_ptr != nullptr ? new V(*other.m_ptr) : nullptr) {}
+
+    constexpr Boxed(Boxed&& other) noexcept : m_ptr(std::exchange(other.m_ptr, nullptr)) {}
+
+    constexpr Boxed& operator=(const Boxed& other) requires(std::is_copy_assignable_v<V>) {
+        if (other.m_ptr == nullptr) {
+            delete std::exchange(m_ptr, nullptr);
+        } else if (m_ptr != nullptr) {
+            *m_ptr = *other.m_ptr;
+        } else {
+            m_ptr = new V(*other.m_ptr);
+        }
+        return *this;
+    }
+
+    constexpr Boxed& operator=(Boxed&& other) noexcept {
+        if (this != &other) {
+            delete m_ptr;
+            m_ptr = std::exchange(other.m_ptr, nullptr);
+        }
+        return *this;
+    }
+
+    constexpr ~Boxed() { delete m_ptr; }
+
+    /** True after the box has been moved from. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool empty() const noexcept { return m_ptr == nullptr; }
+
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr V& get() noexcept { return *m_ptr; }
+
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr const V& get() const noexcept { return *m_ptr; }
+
+private:
+    V* m_ptr;
+};
+
+/**
+ * Tagged union holding either a V or an Err.
+ *
+ * Same layout as std::variant<V, Err> and usable in constant expressions. Assignment between
+ * different alternatives gives the strong guarantee when V is nothrow-move-constructible.
+ *
+ * Once a Result's address escapes, GCC can no longer tie m_has_value to the member that was
+ * constructed and reports the inactive member as maybe-uninitialized where it is destroyed;
+ * std::variant and std::optional avoid this by being system headers.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+template <typename V, typename Policy = DefaultPolicy>
+class ResultStorage {
+public:
+    /** True when the success value is kept in a Boxed<V>, as chosen by Policy::storage. */
+    static constexpr bool boxed =
+        !std::is_same_v<V, std::monostate> &&
+        (Policy::storage == ValueStorage::boxed || (Policy::storage == ValueStorage::automatic && box_value<V>));
+
+    using held_type = std::conditional_t<boxed, Boxed<V>, V>;
+
+    template <typename Arg>
+        requires(!std::is_same_v<std::remove_cvref_t<Arg>, Err> &&
+                 !std::is_base_of_v<ResultStorage, std::remove_cvref_t<Arg>>)
+    FEER_ALWAYS_INLINE constexpr explicit ResultStorage(Arg&& arg) : m_value(FEER_FORWARD(arg)), m_has_value(true) {}
+
+    constexpr explicit ResultStorage(const Err& err) : m_has_value(false) { construct_error(err); }
+
+    constexpr explicit ResultStorage(Err&& err) noexcept : m_has_value(false) { construct_error(FEER_MOVE(err)); }
+
+    constexpr ResultStorage(const ResultStorage& other) requires(std::is_copy_constructible_v<V>)
+        : m_has_value(other.m_has_value) {
+        if (m_has_value) FEER_OK_BRANCH {
+            std::construct_at(&m_value, other.m_value);
+        } else {
+            construct_error(other.m_error);
+        }
+    }
+
+    FEER_ALWAYS_INLINE constexpr ResultStorage(ResultStorage&& other) noexcept(std::is_nothrow_move_constructible_v<held_type>)
+        : m_has_value(other.m_has_value) {
+        if (m_has_value) FEER_OK_BRANCH {
+            std::construct_at(&m_value, FEER_MOVE(other.m_value));
+        } else {
+            construct_error(FEER_MOVE(other.m_error));
+#if FEER_PROPAGATION_METRICS
+            // A failed Result moved into a new one, typically returned to the caller, is one hop. The
+            // move constructor cannot tell a return from a relocation, so those count as well.
+            ++m_error.propagation_hops;
+#endif
+        }
+    }
+
+    constexpr ResultStorage& operator=(const ResultStorage& other) requires(std::is_copy_constructible_v<V> &&
+                                                                           std::is_copy_assignable_v<V>) {
+        if (m_has_value && other.m_has_value) FEER_OK_BRANCH {
+            m_value = other.m_value;
+        } else {
+            assign_state(other);
+        }
+        return *this;
+    }
+
+    constexpr ResultStorage& operator=(ResultStorage&& other) noexcept(std::is_nothrow_move_constructible_v<held_type> &&
+                                                                       std::is_nothrow_move_assignable_v<held_type>) {
+        if (m_has_value && other.m_has_value) FEER_OK_BRANCH {
+            m_value = FEER_MOVE(other.m_value);
+        } else {
+            assign_state(FEER_MOVE(other));
+        }
+        return *this;
+    }
+
+    FEER_ALWAYS_INLINE constexpr ~ResultStorage() { reset(); }
+
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool has_value() const noexcept { return m_has_value; }
+
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr V& value() & {
+        check_state(true);
+        if constexpr (boxed) {
+            check_box();
+            return m_value.get();
+        } else {
+            return m_value;
+        }
+    }
+
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr const V& value() const& {
+        check_state(true);
+        if constexpr (boxed) {
+            check_box();
+            return m_value.get();
+        } else {
+            return m_value;
+        }
+    }
+
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr V&& value() && { return FEER_MOVE(value()); }
+
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr Err& error() & {
+        check_state(false);
+        return m_error;
+    }
+
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr const Err& error() const& {
+        check_state(false);
+        return m_error;
+    }
+
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr Err&& error() && { return FEER_MOVE(error()); }
+
+    /** True when the boxed value has been moved out; callers know has_value(). Always false inline. */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool box_moved_from() const noexcept {
+        if constexpr (boxed) {
+            return m_value.empty();
+        } else {
+            return false;
+        }
+    }
+
+    /** Reports a moved-from boxed value under the access policy, before match picks a handler. */
+    FEER_ALWAYS_INLINE constexpr void check_not_moved_from() const {
+        if constexpr (boxed) {
+            if (m_has_value) {
+                check_box();
+            }
+        }
+    }
+
+    /** The error without the state check, for callers that know !has_value(). */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr Err& held_error() noexcept { return m_error; }
+
+    /** @copydoc held_error */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr const Err& held_error() const noexcept { return m_error; }
+
+private:
+    FEER_ALWAYS_INLINE constexpr void check_state([[maybe_unused]] bool has_value) const {
+        if constexpr (Policy::access != AccessCheck::unchecked) {
+            if (m_has_value != has_value) [[unlikely]] {
+                access_failed();
+            }
+        }
+    }
+
+    // A moved-from boxed value is checked like the wrong state; m_has_value is already known true.
+    FEER_ALWAYS_INLINE constexpr void check_box() const {
+        if constexpr (Policy::access != AccessCheck::unchecked) {
+            if (m_value.empty()) [[unlikely]] {
+                access_failed();
+            }
+        }
+    }
+
+    [[noreturn]] FEER_ALWAYS_INLINE static constexpr void access_failed() {
+        if constexpr (Policy::access == AccessCheck::aborts) {
+            ErrOps::abort_access();
+        } else {
+            ErrOps::bad_access();
+        }
+    }
+
+    constexpr void construct_error(const Err& err) { std::construct_at(&m_error, err); }
+
+    constexpr void construct_error(Err&& err) noexcept { std::construct_at(&m_error, FEER_MOVE(err)); }
 
+    FEER_ALWAYS_INLINE constexpr void reset() noexcept {
+        if (m_has_value) FEER_OK_BRANCH {
+            if constexpr (!std::is_trivially_destructible_v<held_type>) {
+                std::destroy_at(&m_value);
+            }
+        } else {
+            std::destroy_at(&m_error);
+        }
+    }
+
+    // Every assignment except ok = ok, kept out of line per instantiation as std::variant does, so
+    // the state-changing paths are not repeated at each assignment site.
+    template <typename Other>
+    FEER_NOINLINE constexpr void assign_state(Other&& other) {
+        if (!m_has_value && !other.m_has_value) {
+            m_error = FEER_FORWARD(other).m_error;
+        } else if (m_has_value) {
+            if constexpr (std::is_const_v<std::remove_reference_t<Other>>) {
+                Err copy{other.m_error};
+                replace_value_with_error(FEER_MOVE(copy));
+            } else {
+                replace_value_with_error(FEER_MOVE(other.m_error));
+            }
+        } else {
+            replace_error_with_value(FEER_FORWARD(other).m_value);
+        }
+    }
+
+    constexpr void replace_value_with_error(Err&& err) noexcept {
+        reset();
+        construct_error(FEER_MOVE(err));
+        m_has_value = false;
+    }
+
+    // The flag must describe a live object whenever the value's constructor can throw. Like
+    // std::variant, a throwing copy is made into a temporary first when the move cannot throw;
+    // otherwise the error is set aside (moving an Err cannot throw) and put back on failure.
+    template <typename Arg>
+    constexpr void replace_error_with_value(Arg&& value) {
+        if constexpr (std::is_nothrow_constructible_v<held_type, Arg>) {
+            reset();
+            std::construct_at(&m_value, FEER_FORWARD(value));
+        } else if constexpr (std::is_nothrow_move_constructible_v<held_type>) {
+            held_type copy(FEER_FORWARD(value));
+            reset();
+            std::construct_at(&m_value, FEER_MOVE(copy));
+        } else {
+            Err saved{FEER_MOVE(m_error)};
+            reset();
+            try {
+                std::construct_at(&m_value, FEER_FORWARD(value));
+            } catch (...) {
+                construct_error(FEER_MOVE(saved));
+                m_has_value = false;
+                throw;
+            }
+        }
+        m_has_value = true;
+    }
+
+    union {
+        held_type m_value;
+        Err m_error;
+    };
+    bool m_has_value;
+};
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#if FEER_AUDIT_COPIES
 /**
- * @brief Error payload used by feer::Result.
+ * Process-wide copy/move counters, printed to stderr at exit.
  *
- * Keeps a human-readable message and source location of construction.
+ * record() is called from noexcept moves, so it never throws: a sample that cannot be stored
+ * (allocation or locking failed) is only counted as lost and reported with the others.
  */
-struct Err {
-    /** Human-readable error message. */
-    std::string message;
+class CopyAudit {
+public:
+    static CopyAudit& instance() {
+        static CopyAudit audit;
+        return audit;
+    }
 
-    /** Source location captured at error construction time. */
-    std::source_location where = std::source_location::current();
+    void record(
+        const std::source_location& site, std::string_view operation, std::string_view type, bool moved) noexcept {
+        try {
+            const std::lock_guard lock{m_mutex};
+            Counts& counts = m_counts[Key{site.file_name(), site.line(), operation, type}];
+            ++(moved ? counts.moves : counts.copies);
+        } catch (...) {
+            m_lost.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
 
-    /**
-     * @brief Constructs an Err.
-     * @param in_message Error message.
-     * @param in_where Source location for diagnostics.
-     */
-    explicit Err(
-        std::string in_message,
-        std::source_location in_where = std::source_location::current())
-        : message(std::move(in_message)), where(in_where) {}
+    /** Samples dropped because record() could not store them. */
+    [[nodiscard]] std::uint64_t lost() const noexcept { return m_lost.load(std::memory_order_relaxed); }
+
+    void write(std::FILE* out) {
+        const std::lock_guard lock{m_mutex};
+        std::fprintf(out, "feer copy/move audit (%zu entries)\n", m_counts.size());
+        if (const std::uint64_t lost_samples = lost()) {
+            std::fprintf(out, "  %llu samples lost\n", static_cast<unsigned long long>(lost_samples));
+        }
+        for (const auto& [key, counts] : m_counts) {
+            std::fprintf(
+                out,
+                "  %.*s:%u %.*s %.*s copies=%llu moves=%llu\n",
+                static_cast<int>(key.file.size()),
+                key.file.data(),
+                static_cast<unsigned>(key.line),
+                static_cast<int>(key.operation.size()),
+                key.operation.data(),
+                static_cast<int>(key.type.size()),
+                key.type.data(),
+                static_cast<unsigned long long>(counts.copies),
+                static_cast<unsigned long long>(counts.moves));
+        }
+    }
+
+    void reset() {
+        const std::lock_guard lock{m_mutex};
+        m_counts.clear();
+        m_lost.store(0, std::memory_order_relaxed);
+    }
+
+    ~CopyAudit() {
+        if (!m_counts.empty() || lost() != 0) {
+            write(stderr);
+        }
+    }
+
+private:
+    struct Key {
+        std::string_view file;
+        std::uint_least32_t line;
+        std::string_view operation;
+        std::string_view type;
+
+        auto operator<=>(const Key&) const = default;
+    };
+
+    struct Counts {
+        std::uint64_t copies = 0;
+        std::uint64_t moves = 0;
+    };
+
+    std::mutex m_mutex;
+    std::map<Key, Counts> m_counts;
+    std::atomic<std::uint64_t> m_lost{0};
 };
 
-template <typename T>
-class Result;
+template <typename Arg>
+inline constexpr bool audit_is_move = !std::is_lvalue_reference_v<Arg> && !std::is_const_v<std::remove_reference_t<Arg>>;
+
+/**
+ * Result state that records copies and moves of its alternatives.
+ * Values are only counted when CountValue is set (reference Results store a reference_wrapper).
+ */
+template <typename V, bool CountValue, typename Policy = DefaultPolicy>
+class AuditedState : public ResultStorage<V, Policy> {
+public:
+    using base = ResultStorage<V, Policy>;
+
+    template <typename Arg>
+    constexpr AuditedState(Arg&& arg, std::source_location site) : base(std::forward<Arg>(arg)), origin(site) {
+        record("construct", audit_is_move<Arg&&>);
+    }
+
+    constexpr AuditedState(const AuditedState& other) requires(std::is_copy_constructible_v<V>)
+        : base(static_cast<const base&>(other)), origin(other.origin) {
+        record("copy", false);
+    }
+
+    constexpr AuditedState(AuditedState&& other) noexcept(std::is_nothrow_move_constructible_v<typename base::held_type>)
+        : base(static_cast<base&&>(other)), origin(other.origin) {
+        record("move", true);
+    }
+
+    constexpr AuditedState& operator=(const AuditedState& other) requires(std::is_copy_assignable_v<V>) {
+        static_cast<base&>(*this) = static_cast<const base&>(other);
+        origin = other.origin;
+        record("copy-assign", false);
+        return *this;
+    }
+
+    constexpr AuditedState& operator=(AuditedState&& other) noexcept(std::is_nothrow_move_assignable_v<base>) {
+        static_cast<base&>(*this) = static_cast<base&&>(other);
+        origin = other.origin;
+        record("move-assign", true);
+        return *this;
+    }
+
+    constexpr ~AuditedState() = default;
+
+    /** Counts a copy or move of the contained value performed by a Result accessor. */
+    constexpr void record_value(
+        const std::source_location& site, std::string_view operation, bool moved) const noexcept {
+        if (std::is_constant_evaluated()) {
+            return;
+        }
+        if constexpr (CountValue) {
+            CopyAudit::instance().record(site, operation, type_name<V>(), moved);
+        }
+    }
+
+    std::source_location origin;
+
+private:
+    constexpr void record(std::string_view operation, bool moved) const noexcept {
+        if (std::is_constant_evaluated()) {
+            return;
+        }
+        if (!this->has_value()) {
+            CopyAudit::instance().record(origin, operation, type_name<Err>(), moved);
+        } else {
+            record_value(origin, operation, moved);
+        }
+    }
+};
+#endif
+
+#if FEER_CHECK_UNINSPECTED
+/** Tracks whether a Result has been looked at. Copies start uninspected; moved-from objects are disarmed. */
+struct InspectionFlag {
+    constexpr InspectionFlag() noexcept = default;
+    constexpr InspectionFlag(const InspectionFlag&) noexcept {}
+    constexpr InspectionFlag(InspectionFlag&& other) noexcept { other.inspected = true; }
+
+    constexpr InspectionFlag& operator=(const InspectionFlag&) noexcept {
+        inspected = false;
+        return *this;
+    }
+
+    constexpr InspectionFlag& operator=(InspectionFlag&& other) noexcept {
+        inspected = false;
+        other.inspected = true;
+        return *this;
+    }
+
+    mutable bool inspected = false;
+};
+#endif
+
+/** Called whenever an Err is placed into a Result. */
+constexpr void err_propagated([[maybe_unused]] Err& err) noexcept {
+    if (!std::is_constant_evaluated()) {
+        FEER_USDT_ERR_PROBE(err_propagated, err);
+    }
+#if FEER_PROPAGATION_METRICS
+    ++err.propagation_hops;
+#endif
+}
+
+/** Called whenever a Result's error is consumed by match or value_or. */
+FEER_ERR_COLD constexpr void err_handled(const Err& err) {
+    if (std::is_constant_evaluated()) {
+        return;
+    }
+    FEER_USDT_ERR_PROBE(err_handled, err);
+    if (err_handled_hook.load(std::memory_order_relaxed) != nullptr) [[unlikely]] {
+        ErrEvents::handled(err);
+    }
+#if FEER_PROPAGATION_METRICS
+    if (propagation_observer.load(std::memory_order_relaxed) != nullptr) [[unlikely]] {
+        ErrEvents::measured(err);
+    }
+#endif
+}
+
+#if FEER_DEDUCING_THIS
+/** Base with the constness and value category of an explicit object parameter of type Self&&. */
+template <typename Self, typename Base>
+using self_as_t = std::conditional_t<
+    std::is_lvalue_reference_v<Self>,
+    std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const Base&, Base&>,
+    std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const Base&&, Base&&>>;
+
+/** True when an explicit object parameter of type Self&& is a non-const rvalue, which may be moved from. */
+template <typename Self>
+inline constexpr bool consumes_self = !std::is_lvalue_reference_v<Self> && !std::is_const_v<std::remove_reference_t<Self>>;
+#endif
+
+/** std::invoke without its extra call frames when the callable is not a member pointer. */
+template <typename Fn, typename... Args>
+FEER_ALWAYS_INLINE constexpr decltype(auto) invoke(Fn&& fn, Args&&... args) {
+    if constexpr (std::is_member_pointer_v<std::remove_cvref_t<Fn>>) {
+        return std::invoke(FEER_FORWARD(fn), FEER_FORWARD(args)...);
+    } else {
+        return FEER_FORWARD(fn)(FEER_FORWARD(args)...);
+    }
+}
+
+}  // namespace detail
 
-template <>
-class Result<void>;
+#if FEER_AUDIT_COPIES
+/**
+ * @brief Writes the copy/move audit collected so far. Only available with FEER_AUDIT_COPIES=1.
+ */
+inline void write_copy_audit(std::FILE* out = stderr) {
+    detail::CopyAudit::instance().write(out);
+}
+
+/**
+ * @brief Discards the copy/move audit collected so far. Only available with FEER_AUDIT_COPIES=1.
+ */
+inline void reset_copy_audit() {
+    detail::CopyAudit::instance().reset();
+}
+#endif
+
+/**
+ * @brief Compile-time behavior of a BasicResult. Result<T> uses this one.
+ *
+ * Derive from it and redeclare the members to change; everything is resolved at compile time, so
+ * a policy costs nothing beyond the code it selects.
+ *
+ * @code
+ * struct HotPathPolicy : feer::DefaultPolicy {
+ *     static constexpr feer::AccessCheck access = feer::AccessCheck::unchecked;
+ *     static constexpr void propagated(feer::Err&) noexcept {}
+ *     static constexpr void handled(const feer::Err&) noexcept {}
+ * };
+ *
+ * template <typename T>
+ * using HotResult = feer::BasicResult<T, feer::Err, HotPathPolicy>;
+ * @endcode
+ */
+struct DefaultPolicy {
+    /** Where the success value lives. */
+    static constexpr ValueStorage storage = ValueStorage::automatic;
+
+    /** What value() and error() do in the wrong state. */
+    static constexpr AccessCheck access = AccessCheck::throws;
+
+    /** Called whenever an Err is placed into a Result: USDT probe and propagation metrics. */
+    FEER_ALWAYS_INLINE static constexpr void propagated(Err& err) noexcept { detail::err_propagated(err); }
+
+    /** Called whenever a Result's error is consumed by match or value_or: handled hook, probe and metrics. */
+    FEER_ALWAYS_INLINE static constexpr void handled(const Err& err) { detail::err_handled(err); }
+};
+
+template <typename T, typename E = Err, typename Policy = DefaultPolicy>
+class BasicResult;
+
+template <typename Policy>
+class BasicResult<void, Err, Policy>;
+
+/**
+ * @brief Result with the default policy: what every feer API takes and returns.
+ */
+template <typename T, typename E = Err>
+using Result = BasicResult<T, E, DefaultPolicy>;
 
 /**
  * @brief Constructs a successful Result<void>.
  */
-[[nodiscard]] Result<void> Ok();
+[[nodiscard]] constexpr Result<void> Ok();
 
 /**
  * @brief Result container for success value `T` or `Err`.
  *
  * @tparam T Success type.
+ * @tparam E Error type. Only `feer::Err` is handled here; `feer::ErrorSet<...>` is specialized in
+ *           <feer/error_set.hpp> and `Result<double, feer::NanBoxed>` in <feer/nan_boxed.hpp>,
+ *           both for the default policy only.
+ * @tparam Policy Storage, access checking and instrumentation; see feer::DefaultPolicy.
  *
  * Constraints:
  * - `T` must not be `feer::Err`.
@@ -63,8 +1812,13 @@ class Result<void>;
  * }
  * @endcode
  */
-template <typename T>
-class Result {
+template <typename T, typename E, typename Policy>
+class BasicResult {
+
+    static_assert(
+        std::is_same_v<E, Err>,
+        "Result<T, E>: E must be feer::Err, a feer::ErrorSet from <feer/error_set.hpp>, or feer::NanBoxed "
+        "(T = double) from <feer/nan_boxed.hpp>; other policies than feer::DefaultPolicy require feer::Err");
 
     static_assert(
         !std::is_same_v<std::remove_cvref_t<T>, Err>,
@@ -79,38 +1833,148 @@ public:
     using stored_type = std::conditional_t<std::is_reference_v<T>, std::reference_wrapper<value_type>, value_type>;
 
     /** Construct success result from lvalue value (non-reference T). */
-    Result(const value_type& value) requires(!std::is_reference_v<T>) : m_state(value) {}
+    FEER_ALWAYS_INLINE constexpr BasicResult(const value_type& value FEER_AUDIT_SITE) requires(!std::is_reference_v<T>) : m_state(FEER_AUDIT_ARGS(value)) {}
 
     /** Construct success result from rvalue value (non-reference T). */
-    Result(value_type&& value) requires(!std::is_reference_v<T>) : m_state(std::move(value)) {}
+    FEER_ALWAYS_INLINE constexpr BasicResult(value_type&& value FEER_AUDIT_SITE) requires(!std::is_reference_v<T>)
+        : m_state(FEER_AUDIT_ARGS(FEER_MOVE(value))) {}
 
     /** Construct success result from lvalue reference (reference T). */
-    Result(value_type& value) requires(std::is_reference_v<T>) : m_state(std::ref(value)) {}
+    FEER_ALWAYS_INLINE constexpr BasicResult(value_type& value FEER_AUDIT_SITE) requires(std::is_reference_v<T>) : m_state(FEER_AUDIT_ARGS(std::ref(value))) {}
 
     /** Construct error result from lvalue Err. */
-    Result(const Err& err) : m_state(err) {}
+    FEER_ERR_COLD constexpr BasicResult(const Err& err FEER_AUDIT_SITE) : m_state(FEER_AUDIT_ARGS(err)) {
+        Policy::propagated(m_state.held_error());
+    }
 
     /** Construct error result from rvalue Err. */
-    Result(Err&& err) : m_state(std::move(err)) {}
+    FEER_ERR_COLD constexpr BasicResult(Err&& err FEER_AUDIT_SITE) : m_state(FEER_AUDIT_ARGS(std::move(err))) {
+        Policy::propagated(m_state.held_error());
+    }
+
+#if FEER_CHECK_UNINSPECTED
+    constexpr BasicResult(const BasicResult&) = default;
+    constexpr BasicResult(BasicResult&&) = default;
+    constexpr BasicResult& operator=(const BasicResult&) = default;
+    constexpr BasicResult& operator=(BasicResult&&) = default;
+
+    constexpr ~BasicResult() {
+        if (!std::is_constant_evaluated() && !m_inspection.inspected && !m_state.has_value()) [[unlikely]] {
+            detail::ErrEvents::uninspected(m_state.error());
+        }
+    }
+#endif
 
     /** @brief True when this object currently holds a success value. */
-    [[nodiscard]] bool is_ok() const noexcept { return std::holds_alternative<stored_type>(m_state); }
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool is_ok() const noexcept {
+        mark_inspected();
+        return m_state.has_value();
+    }
 
     /** @brief True when this object currently holds an error. */
-    [[nodiscard]] bool is_err() const noexcept { return std::holds_alternative<Err>(m_state); }
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool is_err() const noexcept {
+        mark_inspected();
+        return !m_state.has_value();
+    }
 
     /** @brief Convenience bool conversion. Equivalent to is_ok(). */
-    [[nodiscard]] explicit operator bool() const noexcept { return is_ok(); }
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr explicit operator bool() const noexcept { return is_ok(); }
+
+#if FEER_DEDUCING_THIS
+    /**
+     * @brief Returns the success value with the value category of *this.
+     *
+     * Lvalues give T& or const T&, non-const rvalues move the value out; reference Results always
+     * give the referenced object.
+     * @throws std::bad_variant_access if current state is error.
+     */
+    template <typename Self>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr decltype(auto) value(this Self&& self) {
+        auto&& result = static_cast<detail::self_as_t<Self, BasicResult>>(self);
+        result.mark_inspected();
+        if constexpr (std::is_reference_v<T>) {
+            return result.m_state.value().get();
+        } else if constexpr (detail::consumes_self<Self>) {
+            return FEER_MOVE(result.m_state).value();
+        } else {
+            return (result.m_state.value());
+        }
+    }
+
+    /**
+     * @brief Returns contained value, moved out of non-const rvalues, or fallback if in error state.
+     * @param default_value Fallback value.
+     */
+    template <typename Self, typename U>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr value_type value_or(this Self&& self, U&& default_value FEER_AUDIT_SITE)
+        requires(!std::is_reference_v<T>)
+    {
+        auto&& result = static_cast<detail::self_as_t<Self, BasicResult>>(self);
+        if (result.is_ok()) FEER_OK_BRANCH {
+            if (result.m_state.box_moved_from()) [[unlikely]] {
+                return static_cast<value_type>(FEER_FORWARD(default_value));
+            }
+#if FEER_AUDIT_COPIES
+            result.m_state.record_value(feer_audit_site, "value_or", detail::consumes_self<Self>);
+#endif
+            if constexpr (detail::consumes_self<Self>) {
+                return FEER_MOVE(result.m_state).value();
+            } else {
+                return std::as_const(result.m_state).value();
+            }
+        }
+        Policy::handled(result.m_state.held_error());
+        return static_cast<value_type>(FEER_FORWARD(default_value));
+    }
+
+    /**
+     * @brief Pattern match over success/error state.
+     * @param on_ok Called with the success value: const for lvalues, moved from non-const rvalues,
+     *              the referenced object for reference Results.
+     * @param on_err Called with const Err, or moved Err when the value is moved.
+     * @return Handler return value. Both handlers must return the same type.
+     */
+    template <typename Self, typename OkFn, typename ErrFn>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto match(this Self&& self, OkFn&& on_ok, ErrFn&& on_err) {
+        constexpr bool consume = !std::is_reference_v<T> && detail::consumes_self<Self>;
+        using ok_arg_type =
+            std::conditional_t<consume, value_type&&, std::conditional_t<std::is_reference_v<T>, T, const value_type&>>;
+        using err_arg_type = std::conditional_t<consume, Err&&, const Err&>;
+
+        using ok_return_type = std::invoke_result_t<OkFn, ok_arg_type>;
+        using err_return_type = std::invoke_result_t<ErrFn, err_arg_type>;
 
+        static_assert(
+            std::is_same_v<ok_return_type, err_return_type>,
+            "match requires both handlers to return the same type");
+
+        auto&& result = static_cast<detail::self_as_t<Self, BasicResult>>(self);
+        result.m_state.check_not_moved_from();
+        if (result.is_ok()) FEER_OK_BRANCH {
+            if constexpr (consume) {
+                return detail::invoke(FEER_FORWARD(on_ok), FEER_MOVE(result.m_state).value());
+            } else {
+                return detail::invoke(FEER_FORWARD(on_ok), std::as_const(result).value());
+            }
+        }
+        Policy::handled(result.m_state.held_error());
+        if constexpr (consume) {
+            return detail::invoke(FEER_FORWARD(on_err), FEER_MOVE(result.m_state.held_error()));
+        } else {
+            return detail::invoke(FEER_FORWARD(on_err), std::as_const(result.m_state).held_error());
+        }
+    }
+#else
     /**
      * @brief Returns mutable success value.
      * @throws std::bad_variant_access if current state is error.
      */
-    [[nodiscard]] decltype(auto) value() & {
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr decltype(auto) value() & {
+        mark_inspected();
         if constexpr (std::is_reference_v<T>) {
-            return std::get<stored_type>(m_state).get();
+            return m_state.value().get();
         } else {
-            return (std::get<stored_type>(m_state));
+            return (m_state.value());
         }
     }
 
@@ -118,11 +1982,12 @@ public:
      * @brief Returns const success value.
      * @throws std::bad_variant_access if current state is error.
      */
-    [[nodiscard]] decltype(auto) value() const & {
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr decltype(auto) value() const & {
+        mark_inspected();
         if constexpr (std::is_reference_v<T>) {
-            return std::get<stored_type>(m_state).get();
+            return m_state.value().get();
         } else {
-            return (std::get<stored_type>(m_state));
+            return (m_state.value());
         }
     }
 
@@ -130,8 +1995,9 @@ public:
      * @brief Moves success value out of an rvalue Result.
      * @throws std::bad_variant_access if current state is error.
      */
-    [[nodiscard]] value_type&& value() && requires(!std::is_reference_v<T>) {
-        return std::get<stored_type>(std::move(m_state));
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr value_type&& value() && requires(!std::is_reference_v<T>) {
+        mark_inspected();
+        return FEER_MOVE(m_state).value();
     }
 
     /**
@@ -139,11 +2005,18 @@ public:
      * @param default_value Fallback value.
      */
     template <typename U>
-    [[nodiscard]] value_type value_or(U&& default_value) const& requires(!std::is_reference_v<T>) {
-        if (is_ok()) {
-            return std::get<stored_type>(m_state);
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr value_type value_or(U&& default_value FEER_AUDIT_SITE) const& requires(!std::is_reference_v<T>) {
+        if (is_ok()) FEER_OK_BRANCH {
+            if (m_state.box_moved_from()) [[unlikely]] {
+                return static_cast<value_type>(FEER_FORWARD(default_value));
+            }
+#if FEER_AUDIT_COPIES
+            m_state.record_value(feer_audit_site, "value_or", false);
+#endif
+            return m_state.value();
         }
-        return static_cast<value_type>(std::forward<U>(default_value));
+        Policy::handled(m_state.held_error());
+        return static_cast<value_type>(FEER_FORWARD(default_value));
     }
 
     /**
@@ -151,11 +2024,18 @@ public:
      * @param default_value Fallback value.
      */
     template <typename U>
-    [[nodiscard]] value_type value_or(U&& default_value) && requires(!std::is_reference_v<T>) {
-        if (is_ok()) {
-            return std::get<stored_type>(std::move(m_state));
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr value_type value_or(U&& default_value FEER_AUDIT_SITE) && requires(!std::is_reference_v<T>) {
+        if (is_ok()) FEER_OK_BRANCH {
+            if (m_state.box_moved_from()) [[unlikely]] {
+                return static_cast<value_type>(FEER_FORWARD(default_value));
+            }
+#if FEER_AUDIT_COPIES
+            m_state.record_value(feer_audit_site, "value_or", true);
+#endif
+            return FEER_MOVE(m_state).value();
         }
-        return static_cast<value_type>(std::forward<U>(default_value));
+        Policy::handled(m_state.held_error());
+        return static_cast<value_type>(FEER_FORWARD(default_value));
     }
 
     /**
@@ -165,7 +2045,7 @@ public:
      * @return Handler return value. Both handlers must return the same type.
      */
     template <typename OkFn, typename ErrFn>
-    [[nodiscard]] auto match(OkFn&& on_ok, ErrFn&& on_err) const& {
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto match(OkFn&& on_ok, ErrFn&& on_err) const& {
         using ok_arg_type = std::conditional_t<std::is_reference_v<T>, T, const value_type&>;
 
         using ok_return_type = std::invoke_result_t<OkFn, ok_arg_type>;
@@ -175,10 +2055,12 @@ public:
             std::is_same_v<ok_return_type, err_return_type>,
             "match requires both handlers to return the same type");
 
-        if (is_ok()) {
-            return std::invoke(std::forward<OkFn>(on_ok), value());
+        m_state.check_not_moved_from();
+        if (is_ok()) FEER_OK_BRANCH {
+            return detail::invoke(FEER_FORWARD(on_ok), value());
         }
-        return std::invoke(std::forward<ErrFn>(on_err), error());
+        Policy::handled(m_state.held_error());
+        return detail::invoke(FEER_FORWARD(on_err), m_state.held_error());
     }
 
     /**
@@ -188,7 +2070,7 @@ public:
      * @return Handler return value. Both handlers must return the same type.
      */
     template <typename OkFn, typename ErrFn>
-    [[nodiscard]] auto match(OkFn&& on_ok, ErrFn&& on_err) && requires(!std::is_reference_v<T>) {
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto match(OkFn&& on_ok, ErrFn&& on_err) && requires(!std::is_reference_v<T>) {
         using ok_return_type = std::invoke_result_t<OkFn, value_type&&>;
         using err_return_type = std::invoke_result_t<ErrFn, Err&&>;
 
@@ -196,49 +2078,138 @@ public:
             std::is_same_v<ok_return_type, err_return_type>,
             "match requires both handlers to return the same type");
 
-        if (is_ok()) {
-            return std::invoke(std::forward<OkFn>(on_ok), std::get<stored_type>(std::move(m_state)));
+        m_state.check_not_moved_from();
+        if (is_ok()) FEER_OK_BRANCH {
+            return detail::invoke(FEER_FORWARD(on_ok), FEER_MOVE(m_state).value());
         }
-        return std::invoke(std::forward<ErrFn>(on_err), std::get<Err>(std::move(m_state)));
+        Policy::handled(m_state.held_error());
+        return detail::invoke(FEER_FORWARD(on_err), FEER_MOVE(m_state.held_error()));
     }
 
+#endif
+
     /**
      * @brief Returns mutable error.
      * @throws std::bad_variant_access if current state is success.
      */
-    [[nodiscard]] Err& error() & { return std::get<Err>(m_state); }
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr Err& error() & {
+        mark_inspected();
+        return m_state.error();
+    }
 
     /**
      * @brief Returns const error.
      * @throws std::bad_variant_access if current state is success.
      */
-    [[nodiscard]] const Err& error() const& { return std::get<Err>(m_state); }
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr const Err& error() const& {
+        mark_inspected();
+        return m_state.error();
+    }
+
+    /**
+     * @brief Moves the error out, for propagation.
+     * @throws std::bad_variant_access if current state is success.
+     */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr Err&& error() && {
+        mark_inspected();
+        return FEER_MOVE(m_state).error();
+    }
 
 private:
-    std::variant<stored_type, Err> m_state;
+    FEER_ALWAYS_INLINE constexpr void mark_inspected() const noexcept {
+#if FEER_CHECK_UNINSPECTED
+        if (!std::is_constant_evaluated()) {
+            m_inspection.inspected = true;
+        }
+#endif
+    }
+
+#if FEER_AUDIT_COPIES
+    detail::AuditedState<stored_type, !std::is_reference_v<T>, Policy> m_state;
+#else
+    detail::ResultStorage<stored_type, Policy> m_state;
+#endif
+
+#if FEER_CHECK_UNINSPECTED
+    detail::InspectionFlag m_inspection;
+#endif
 };
 
-template <>
-class Result<void> {
+template <typename Policy>
+class BasicResult<void, Err, Policy> {
 public:
     /** Construct success result for void. */
-    Result() : m_state(std::monostate{}) {}
+    FEER_ALWAYS_INLINE constexpr BasicResult(FEER_AUDIT_SITE_ONLY) : m_state(FEER_AUDIT_ARGS(std::monostate{})) {}
 
     /** Construct error result from lvalue Err. */
-    Result(const Err& err) : m_state(err) {}
+    FEER_ERR_COLD constexpr BasicResult(const Err& err FEER_AUDIT_SITE) : m_state(FEER_AUDIT_ARGS(err)) {
+        Policy::propagated(m_state.held_error());
+    }
 
     /** Construct error result from rvalue Err. */
-    Result(Err&& err) : m_state(std::move(err)) {}
+    FEER_ERR_COLD constexpr BasicResult(Err&& err FEER_AUDIT_SITE) : m_state(FEER_AUDIT_ARGS(std::move(err))) {
+        Policy::propagated(m_state.held_error());
+    }
+
+#if FEER_CHECK_UNINSPECTED
+    constexpr BasicResult(const BasicResult&) = default;
+    constexpr BasicResult(BasicResult&&) = default;
+    constexpr BasicResult& operator=(const BasicResult&) = default;
+    constexpr BasicResult& operator=(BasicResult&&) = default;
+
+    constexpr ~BasicResult() {
+        if (!std::is_constant_evaluated() && !m_inspection.inspected && !m_state.has_value()) [[unlikely]] {
+            detail::ErrEvents::uninspected(m_state.error());
+        }
+    }
+#endif
 
     /** @brief True when this object currently holds success. */
-    [[nodiscard]] bool is_ok() const noexcept { return std::holds_alternative<std::monostate>(m_state); }
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool is_ok() const noexcept {
+        mark_inspected();
+        return m_state.has_value();
+    }
 
     /** @brief True when this object currently holds an error. */
-    [[nodiscard]] bool is_err() const noexcept { return std::holds_alternative<Err>(m_state); }
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr bool is_err() const noexcept {
+        mark_inspected();
+        return !m_state.has_value();
+    }
 
     /** @brief Convenience bool conversion. Equivalent to is_ok(). */
-    [[nodiscard]] explicit operator bool() const noexcept { return is_ok(); }
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr explicit operator bool() const noexcept { return is_ok(); }
+
+#if FEER_DEDUCING_THIS
+    /**
+     * @brief Pattern match over success/error state.
+     * @param on_ok Called with no parameters when state is ok.
+     * @param on_err Called with const Err, or moved Err when *this is a non-const rvalue.
+     * @return Handler return value. Both handlers must return the same type.
+     */
+    template <typename Self, typename OkFn, typename ErrFn>
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto match(this Self&& self, OkFn&& on_ok, ErrFn&& on_err) {
+        constexpr bool consume = detail::consumes_self<Self>;
+        using err_arg_type = std::conditional_t<consume, Err&&, const Err&>;
+
+        using ok_return_type = std::invoke_result_t<OkFn>;
+        using err_return_type = std::invoke_result_t<ErrFn, err_arg_type>;
+
+        static_assert(
+            std::is_same_v<ok_return_type, err_return_type>,
+            "match requires both handlers to return the same type");
 
+        auto&& result = static_cast<detail::self_as_t<Self, BasicResult>>(self);
+        if (result.is_ok()) FEER_OK_BRANCH {
+            return detail::invoke(FEER_FORWARD(on_ok));
+        }
+        Policy::handled(result.m_state.held_error());
+        if constexpr (consume) {
+            return detail::invoke(FEER_FORWARD(on_err), FEER_MOVE(result.m_state.held_error()));
+        } else {
+            return detail::invoke(FEER_FORWARD(on_err), std::as_const(result.m_state).held_error());
+        }
+    }
+#else
     /**
      * @brief Pattern match over success/error state.
      * @param on_ok Called with no parameters when state is ok.
@@ -246,7 +2217,7 @@ public:
      * @return Handler return value. Both handlers must return the same type.
      */
     template <typename OkFn, typename ErrFn>
-    [[nodiscard]] auto match(OkFn&& on_ok, ErrFn&& on_err) const& {
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto match(OkFn&& on_ok, ErrFn&& on_err) const& {
         using ok_return_type = std::invoke_result_t<OkFn>;
         using err_return_type = std::invoke_result_t<ErrFn, const Err&>;
 
@@ -254,10 +2225,11 @@ public:
             std::is_same_v<ok_return_type, err_return_type>,
             "match requires both handlers to return the same type");
 
-        if (is_ok()) {
-            return std::invoke(std::forward<OkFn>(on_ok));
+        if (is_ok()) FEER_OK_BRANCH {
+            return detail::invoke(FEER_FORWARD(on_ok));
         }
-        return std::invoke(std::forward<ErrFn>(on_err), error());
+        Policy::handled(m_state.held_error());
+        return detail::invoke(FEER_FORWARD(on_err), m_state.held_error());
     }
 
     /**
@@ -267,7 +2239,7 @@ public:
      * @return Handler return value. Both handlers must return the same type.
      */
     template <typename OkFn, typename ErrFn>
-    [[nodiscard]] auto match(OkFn&& on_ok, ErrFn&& on_err) && {
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr auto match(OkFn&& on_ok, ErrFn&& on_err) && {
         using ok_return_type = std::invoke_result_t<OkFn>;
         using err_return_type = std::invoke_result_t<ErrFn, Err&&>;
 
@@ -275,30 +2247,114 @@ public:
             std::is_same_v<ok_return_type, err_return_type>,
             "match requires both handlers to return the same type");
 
-        if (is_ok()) {
-            return std::invoke(std::forward<OkFn>(on_ok));
+        if (is_ok()) FEER_OK_BRANCH {
+            return detail::invoke(FEER_FORWARD(on_ok));
         }
-        return std::invoke(std::forward<ErrFn>(on_err), std::get<Err>(std::move(m_state)));
+        Policy::handled(m_state.held_error());
+        return detail::invoke(FEER_FORWARD(on_err), FEER_MOVE(m_state.held_error()));
     }
 
+#endif
+
     /**
      * @brief Returns mutable error.
      * @throws std::bad_variant_access if current state is success.
      */
-    [[nodiscard]] Err& error() & { return std::get<Err>(m_state); }
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr Err& error() & {
+        mark_inspected();
+        return m_state.error();
+    }
 
     /**
      * @brief Returns const error.
      * @throws std::bad_variant_access if current state is success.
      */
-    [[nodiscard]] const Err& error() const& { return std::get<Err>(m_state); }
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr const Err& error() const& {
+        mark_inspected();
+        return m_state.error();
+    }
+
+    /**
+     * @brief Moves the error out, for propagation.
+     * @throws std::bad_variant_access if current state is success.
+     */
+    [[nodiscard]] FEER_ALWAYS_INLINE constexpr Err&& error() && {
+        mark_inspected();
+        return FEER_MOVE(m_state).error();
+    }
 
 private:
-    std::variant<std::monostate, Err> m_state;
+    FEER_ALWAYS_INLINE constexpr void mark_inspected() const noexcept {
+#if FEER_CHECK_UNINSPECTED
+        if (!std::is_constant_evaluated()) {
+            m_inspection.inspected = true;
+        }
+#endif
+    }
+
+#if FEER_AUDIT_COPIES
+    detail::AuditedState<std::monostate, false, Policy> m_state;
+#else
+    detail::ResultStorage<std::monostate, Policy> m_state;
+#endif
+
+#if FEER_CHECK_UNINSPECTED
+    detail::InspectionFlag m_inspection;
+#endif
 };
 
-inline Result<void> Ok() {
+constexpr Result<void> Ok() {
     return Result<void>{};
 }
 
+namespace detail {
+
+/** What FEER_TRY returns from a failed Result: the errors of an ErrorSet Result, otherwise its Err. */
+template <typename R>
+FEER_ALWAYS_INLINE constexpr decltype(auto) try_error(R&& result) {
+    if constexpr (requires { FEER_FORWARD(result).errors(); }) {
+        return FEER_FORWARD(result).errors();
+    } else {
+        return FEER_FORWARD(result).error();
+    }
+}
+
+/** What FEER_TRY evaluates to for a successful Result; nothing for Result<void>. */
+template <typename R>
+FEER_ALWAYS_INLINE constexpr decltype(auto) try_value(R&& result) {
+    if constexpr (requires { FEER_FORWARD(result).value(); }) {
+        return FEER_FORWARD(result).value();
+    }
+}
+
+}  // namespace detail
+
 }  // namespace feer
+
+/**
+ * @brief Evaluates to the value of a Result, or returns its error from the enclosing function.
+ *
+ * For Result<T> the Err is returned, so the enclosing function may return a Result of any type.
+ * For Results with an ErrorSet (feer/error_set.hpp) the errors are returned and widen into the
+ * enclosing function's set, so a missing error type is a compile error. A temporary Result is
+ * moved from; a named one is copied from and left unchanged. Uses a statement expression, so only
+ * available on GCC and Clang.
+ *
+ * @code
+ * feer::Result<Config> load(const std::string& path) {
+ *     std::string text = FEER_TRY(read_file(path));
+ *     return parse_config(text);
+ * }
+ * @endcode
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define FEER_TRY(...)                                                                          \
+    __extension__({                                                                            \
+        auto&& feer_try_result_ = (__VA_ARGS__);                                               \
+        using feer_try_type_ = decltype(feer_try_result_);                                     \
+        if (!feer_try_result_.is_ok()) [[unlikely]] {                                          \
+            return ::feer::detail::try_error(static_cast<feer_try_type_&&>(feer_try_result_)); \
+        }                                                                                      \
+        ::feer::detail::try_value(static_cast<feer_try_type_&&>(feer_try_result_));            \
+    })
+#endif
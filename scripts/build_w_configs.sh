@@ -0,0 +1,25 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# Builds and tests each option that changes Result or Err storage, warning-clean with -Wall -Wextra -Werror.
+BUILD_ROOT="${1:-build-configs}"
+
+configs=(
+    "release:-DCMAKE_BUILD_TYPE=Release"
+    "audit-copies:-DCMAKE_BUILD_TYPE=Release -DFEER_AUDIT_COPIES=ON"
+    "box-threshold:-DCMAKE_BUILD_TYPE=Release -DFEER_BOX_THRESHOLD=64"
+    "err-payloads:-DCMAKE_BUILD_TYPE=Release -DFEER_ERR_PAYLOADS=ON"
+    "intern-messages:-DCMAKE_BUILD_TYPE=Release -DFEER_INTERN_MESSAGES=ON"
+    "propagation-metrics:-DCMAKE_BUILD_TYPE=Release -DFEER_PROPAGATION_METRICS=ON"
+    "check-uninspected:-DCMAKE_BUILD_TYPE=Debug -DFEER_CHECK_UNINSPECTED=ON"
+)
+
+for config in "${configs[@]}"; do
+    name="${config%%:*}"
+    read -r -a options <<< "${config#*:}"
+    build_dir="${BUILD_ROOT}/${name}"
+
+    cmake -S . -B "${build_dir}" -DFEER_BUILD_TESTS=ON -DCMAKE_CXX_FLAGS="-Wall -Wextra -Werror" "${options[@]}"
+    cmake --build "${build_dir}"
+    ctest --test-dir "${build_dir}" --output-on-failure
+done
@@ -0,0 +1,16 @@
+#include <feer/compile_time.hpp>
+
+#include <cstdint>
+
+constexpr feer::Result<std::uint16_t> parse_port(int value) {
+    if (value > 65535) {
+        return feer::Err{"port out of range"};
+    }
+    return static_cast<std::uint16_t>(value);
+}
+
+constexpr std::uint16_t port = feer::compile_time_value<[] { return parse_port(99999); }>();
+
+int main() {
+    return port;
+}
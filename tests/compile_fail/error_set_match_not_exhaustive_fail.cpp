@@ -0,0 +1,19 @@
+#include <feer/error_set.hpp>
+
+struct IoError {};
+struct ParseError {};
+
+int main() {
+    feer::Result<int, feer::ErrorSet<IoError, ParseError>> value = ParseError{};
+
+    auto out = value.match(
+        [](int v) {
+            return v;
+        },
+        [](IoError) {
+            return -1;
+        });
+
+    (void)out;
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <doctest/doctest.h>
+#include <feer/any_result.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using feer::AnyResult;
+using feer::Err;
+using feer::Result;
+
+namespace feer_tests {
+
+struct Big {
+    std::array<char, 256> bytes{};
+};
+
+}  // namespace feer_tests
+
+static_assert(feer::type_id<int> != feer::type_id<long>);
+static_assert(feer::type_id<const int> == feer::type_id<int>);
+static_assert(feer::type_name<feer_tests::Big> == "feer_tests::Big");
+#if !FEER_AUDIT_COPIES && !FEER_PROPAGATION_METRICS && !FEER_ERR_PAYLOADS
+static_assert(feer::detail::any_result_inline<Result<int>>);
+static_assert(feer::detail::any_result_inline<Result<std::string>>);
+#endif
+#if !FEER_BOX_THRESHOLD
+static_assert(!feer::detail::any_result_inline<Result<feer_tests::Big>>);
+#endif
+
+TEST_CASE("AnyResult holds results of different types") {
+    std::vector<AnyResult> outputs;
+    outputs.emplace_back(Result<int>{42});
+    outputs.emplace_back(Result<std::string>{Err{"plugin failed"}});
+    outputs.emplace_back(Result<feer_tests::Big>{feer_tests::Big{}});
+    outputs.emplace_back(Result<void>{});
+
+    CHECK(outputs[0].holds<int>());
+    CHECK_FALSE(outputs[0].holds<long>());
+    CHECK_FALSE(outputs[0].holds<const int>());
+    CHECK(outputs[0].is_ok());
+    REQUIRE(outputs[0].downcast<int>() != nullptr);
+    CHECK(outputs[0].downcast<int>()->value() == 42);
+    CHECK(outputs[0].downcast<std::string>() == nullptr);
+
+    CHECK(outputs[1].is_err());
+    CHECK(outputs[1].error().message == "plugin failed");
+    CHECK(outputs[1].type() == feer::type_id<std::string>);
+
+    CHECK(outputs[2].is_ok());
+    CHECK(std::as_const(outputs[2]).downcast<feer_tests::Big>() != nullptr);
+    CHECK(outputs[3].holds<void>());
+}
+
+TEST_CASE("AnyResult recognizes its types through another library's vtable") {
+    const feer::detail::AnyResultVTable plugin_copy = feer::detail::any_result_vtable<int>;
+    CHECK(feer::detail::any_result_holds<int>(&plugin_copy));
+    CHECK_FALSE(feer::detail::any_result_holds<const int>(&plugin_copy));
+    CHECK_FALSE(feer::detail::any_result_holds<long>(&plugin_copy));
+    CHECK_FALSE(feer::detail::any_result_holds<int>(nullptr));
+}
+
+TEST_CASE("AnyResult moves and takes its result") {
+    AnyResult held{Result<std::unique_ptr<int>>{std::make_unique<int>(7)}};
+    AnyResult moved = std::move(held);
+    CHECK_FALSE(held.has_value());
+    CHECK(moved.has_value());
+
+    const Result<long> wrong = moved.take<long>();
+    REQUIRE(wrong.is_err());
+    CHECK(std::string_view{wrong.error().message}.find("not long") != std::string_view::npos);
+    CHECK(moved.has_value());
+
+    Result<std::unique_ptr<int>> taken = moved.take<std::unique_ptr<int>>();
+    CHECK(*taken.value() == 7);
+    CHECK_FALSE(moved.has_value());
+    CHECK_THROWS_AS((void)moved.is_ok(), std::bad_variant_access);
+
+    AnyResult big{Result<feer_tests::Big>{feer_tests::Big{}}};
+    big = AnyResult{Result<int>{1}};
+    CHECK(big.holds<int>());
+}
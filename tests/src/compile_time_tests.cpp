@@ -0,0 +1,103 @@
+#include <doctest/doctest.h>
+#include <feer/compile_time.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+using feer::Err;
+using feer::Result;
+
+namespace {
+
+constexpr Result<std::uint16_t> parse_port(std::string_view text) {
+    if (text.empty()) {
+        return Err{"empty port"};
+    }
+    std::uint32_t port = 0;
+    for (const char c : text) {
+        if (c < '0' || c > '9') {
+            return Err{"port must be decimal, got '" + std::string{text} + "'"};
+        }
+        port = port * 10 + static_cast<std::uint32_t>(c - '0');
+        if (port > 65535) {
+            return Err{"port out of range"};
+        }
+    }
+    return static_cast<std::uint16_t>(port);
+}
+
+constexpr Result<void> validate_name(std::string_view name) {
+    if (name.empty() || name.size() > 16) {
+        return Err{"service name must have 1-16 characters"};
+    }
+    return feer::Ok();
+}
+
+struct Endpoint {
+    std::string_view name;
+    std::uint16_t port;
+};
+
+constexpr Result<Endpoint> parse_endpoint(std::string_view entry) {
+    const std::size_t colon = entry.find(':');
+    if (colon == std::string_view::npos) {
+        return Err{"expected name:port"};
+    }
+    const std::string_view name = entry.substr(0, colon);
+    if (Result<void> valid = validate_name(name); !valid) {
+        return valid.error();
+    }
+    return parse_port(entry.substr(colon + 1)).match(
+        [&](std::uint16_t port) -> Result<Endpoint> { return Endpoint{name, port}; },
+        [](const Err& err) -> Result<Endpoint> { return err; });
+}
+
+template <std::size_t N>
+constexpr std::array<Endpoint, N> build_table(const std::array<std::string_view, N>& entries) {
+    std::array<Endpoint, N> table{};
+    for (std::size_t i = 0; i < N; ++i) {
+        table[i] = parse_endpoint(entries[i]).value_or(Endpoint{"invalid", 0});
+    }
+    return table;
+}
+
+}  // namespace
+
+TEST_CASE("Result and Err are usable in constant expressions") {
+    static_assert(parse_port("8080").is_ok());
+    static_assert(parse_port("8080").value() == 8080);
+    static_assert(parse_port("99999").is_err());
+    static_assert(parse_port("").error().message == "empty port");
+    static_assert(parse_port("80a").error().message == "port must be decimal, got '80a'");
+    static_assert(validate_name("metrics").is_ok());
+    static_assert(!validate_name(""));
+    static_assert(parse_port("x").value_or(1) == 1);
+
+    constexpr Result<int> copied = [] {
+        Result<int> a = Err{"first"};
+        Result<int> b = 7;
+        a = b;
+        b = Err{"second"};
+        return a;
+    }();
+    static_assert(copied.value() == 7);
+
+    CHECK(parse_port("443").value() == 443);
+}
+
+TEST_CASE("lookup tables are built and validated at compile time") {
+    constexpr auto table = build_table(std::array<std::string_view, 3>{"http:80", "https:443", "broken"});
+    static_assert(table[0].port == 80);
+    static_assert(table[1].name == "https");
+    static_assert(table[2].name == "invalid");
+
+    constexpr Endpoint metrics = feer::compile_time_value<[] { return parse_endpoint("metrics:9100"); }>();
+    static_assert(metrics.port == 9100);
+    feer::compile_time_value<[] { return validate_name("gateway"); }>();
+
+    CHECK(table[1].port == 443);
+    CHECK(metrics.name == "metrics");
+}
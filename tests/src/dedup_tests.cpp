@@ -0,0 +1,155 @@
+#include <doctest/doctest.h>
+#include <feer/dedup.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace feer;
+using namespace std::chrono_literals;
+
+namespace {
+
+Deduplicator<>::clock::time_point at(std::chrono::milliseconds offset) {
+    return Deduplicator<>::clock::time_point{std::chrono::hours{1} + offset};
+}
+
+Err make_err(const char* message) {
+    return Err{message};
+}
+
+}  // namespace
+
+TEST_CASE("Err fingerprint is stable per site, whatever the message") {
+    const Err first = make_err("connection reset by peer: 10.0.0.5");
+    const Err second = make_err("connection reset by peer: 10.0.0.6");
+    const Err other_site{"connection reset by peer: 10.0.0.5"};
+
+    CHECK(first.fingerprint() == second.fingerprint());
+    CHECK(first.fingerprint() != other_site.fingerprint());
+    CHECK(first.fingerprint() != 0);
+    CHECK(fingerprint(first.where, "disk full") != fingerprint(first.where, "disk gone"));
+    CHECK(fingerprint(first.where, "disk full") != first.fingerprint());
+}
+
+TEST_CASE("fingerprint is usable in constant expressions") {
+    constexpr auto where = std::source_location::current();
+    constexpr std::uint64_t fp = fingerprint(where);
+
+    static_assert(fp != 0);
+    static_assert(fingerprint(where, "timeout") != fp);
+    CHECK(Err("timeout", where).fingerprint() == fp);
+}
+
+TEST_CASE("Deduplicator collapses repeats within the window") {
+    Deduplicator<> dedup{1s};
+    const Err err = make_err("connection reset");
+
+    auto verdict = dedup.observe(err, at(0ms));
+    CHECK(verdict.emit);
+    CHECK(verdict.suppressed == 0);
+
+    for (int i = 0; i < 5; ++i) {
+        CHECK_FALSE(dedup.observe(err, at(100ms)).emit);
+    }
+
+    verdict = dedup.observe(err, at(1500ms));
+    CHECK(verdict.emit);
+    CHECK(verdict.suppressed == 5);
+
+    verdict = dedup.observe(err, at(3000ms));
+    CHECK(verdict.emit);
+    CHECK(verdict.suppressed == 0);
+}
+
+TEST_CASE("Deduplicator tracks fingerprints independently") {
+    Deduplicator<> dedup{1s};
+
+    const Err a{"a"};
+    const Err b{"b"};
+
+    CHECK(dedup.observe(a, at(0ms)).emit);
+    CHECK(dedup.observe(b, at(0ms)).emit);
+    CHECK_FALSE(dedup.observe(a, at(10ms)).emit);
+    CHECK_FALSE(dedup.observe(b, at(10ms)).emit);
+}
+
+TEST_CASE("Deduplicator drain reports pending suppressed counts") {
+    Deduplicator<> dedup{1s};
+    const Err err = make_err("drained");
+
+    static_cast<void>(dedup.observe(err, at(0ms)));
+    static_cast<void>(dedup.observe(err, at(1ms)));
+    static_cast<void>(dedup.observe(err, at(2ms)));
+
+    std::uint64_t seen_fingerprint = 0;
+    std::uint64_t seen_count = 0;
+    dedup.drain([&](std::uint64_t fp, std::uint64_t count) {
+        seen_fingerprint = fp;
+        seen_count = count;
+    });
+
+    CHECK(seen_fingerprint == err.fingerprint());
+    CHECK(seen_count == 2);
+
+    std::uint64_t calls = 0;
+    dedup.drain([&](std::uint64_t, std::uint64_t) { ++calls; });
+    CHECK(calls == 0);
+}
+
+TEST_CASE("Deduplicator fails open when the table is full") {
+    Deduplicator<2> dedup{1s};
+
+    CHECK(dedup.observe(std::uint64_t{1}, at(0ms)).emit);
+    CHECK(dedup.observe(std::uint64_t{2}, at(0ms)).emit);
+    CHECK(dedup.observe(std::uint64_t{3}, at(0ms)).emit);
+    CHECK(dedup.observe(std::uint64_t{3}, at(0ms)).emit);
+}
+
+TEST_CASE("Deduplicator reuses slots whose window has ended") {
+    Deduplicator<2> dedup{1s};
+
+    CHECK(dedup.observe(std::uint64_t{1}, at(0ms)).emit);
+    CHECK(dedup.observe(std::uint64_t{2}, at(0ms)).emit);
+    CHECK_FALSE(dedup.observe(std::uint64_t{2}, at(10ms)).emit);
+
+    // 1 has expired with nothing pending; 2 has a pending count and keeps its slot.
+    CHECK(dedup.observe(std::uint64_t{3}, at(2000ms)).emit);
+    CHECK_FALSE(dedup.observe(std::uint64_t{3}, at(2010ms)).emit);
+
+    const DedupVerdict verdict = dedup.observe(std::uint64_t{2}, at(2020ms));
+    CHECK(verdict.emit);
+    CHECK(verdict.suppressed == 1);
+
+    for (std::uint64_t key = 10; key < 1000; ++key) {
+        CHECK(dedup.observe(key, at(std::chrono::milliseconds{5000 + 2000 * static_cast<std::int64_t>(key)})).emit);
+    }
+}
+
+TEST_CASE("Deduplicator counts every occurrence under contention") {
+    Deduplicator<> dedup{1h};
+    const Err err = make_err("storm");
+    std::atomic<std::uint64_t> emitted{0};
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&] {
+            for (int i = 0; i < 1000; ++i) {
+                if (dedup.observe(err, at(0ms)).emit) {
+                    emitted.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    std::uint64_t suppressed = 0;
+    dedup.drain([&](std::uint64_t, std::uint64_t count) { suppressed += count; });
+
+    CHECK(emitted.load() == 1);
+    CHECK(suppressed == 3999);
+}
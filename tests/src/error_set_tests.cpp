@@ -0,0 +1,210 @@
+#include <doctest/doctest.h>
+#include <feer/error_set.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+using feer::ErrorSet;
+using feer::Result;
+
+namespace {
+
+enum class IoError : std::uint8_t { not_found, denied };
+
+struct ParseError {
+    std::uint32_t line;
+};
+
+struct ConfigError {
+    std::string key;
+};
+
+struct Config {
+    std::uint32_t port;
+};
+
+using ReadErrors = ErrorSet<IoError>;
+using ParseErrors = ErrorSet<ParseError, IoError>;
+using LoadErrors = feer::error_set_union_t<ReadErrors, ParseErrors>;
+
+Result<std::string, ReadErrors> read_file(const std::string& path) {
+    if (path == "missing") {
+        return IoError::not_found;
+    }
+    return std::string{path == "bad" ? "port=x" : "port=8080"};
+}
+
+Result<Config, ErrorSet<ParseError>> parse_config(const std::string& text) {
+    if (text != "port=8080") {
+        return ParseError{1};
+    }
+    return Config{8080};
+}
+
+Result<Config, LoadErrors> load(const std::string& path) {
+    std::string text = FEER_TRY(read_file(path));
+    Config config = FEER_TRY(parse_config(text));
+    return config;
+}
+
+Result<void, ErrorSet<IoError, ParseError, ConfigError>> validate(const std::string& path) {
+    const Config config = FEER_TRY(load(path));
+    if (config.port < 1024) {
+        return ConfigError{"port"};
+    }
+    return {};
+}
+
+struct ThrowsOnMove {
+    explicit ThrowsOnMove(bool in_fail) : fail(in_fail) {}
+    ThrowsOnMove(const ThrowsOnMove&) = default;
+
+    ThrowsOnMove(ThrowsOnMove&& other) : fail(other.fail) {
+        if (fail) {
+            throw std::runtime_error{"move failed"};
+        }
+    }
+
+    ThrowsOnMove& operator=(const ThrowsOnMove&) = default;
+    ThrowsOnMove& operator=(ThrowsOnMove&&) = default;
+
+    bool fail;
+};
+
+const char* describe(const Result<Config, LoadErrors>& result) {
+    return result.match(
+        [](const Config&) { return "ok"; },
+        [](IoError) { return "io"; },
+        [](const ParseError&) { return "parse"; });
+}
+
+}  // namespace
+
+static_assert(std::is_same_v<LoadErrors, ErrorSet<IoError, ParseError>>);
+static_assert(std::is_same_v<feer::error_set_union_t<ErrorSet<int>, ErrorSet<long, int>, ErrorSet<char>>,
+                             ErrorSet<int, long, char>>);
+
+static_assert(sizeof(Result<void, ErrorSet<IoError>>) == 2);
+static_assert(sizeof(Result<void, ErrorSet<IoError, std::uint32_t>>) == sizeof(std::uint32_t) * 2);
+static_assert(sizeof(Result<std::uint32_t, ErrorSet<IoError, ParseError>>) == 8);
+static_assert(sizeof(Result<void, ErrorSet<ConfigError, IoError>>) <= sizeof(ConfigError) + alignof(ConfigError));
+static_assert(std::is_trivially_copyable_v<Result<std::uint32_t, ErrorSet<IoError, ParseError>>>);
+static_assert(!std::is_trivially_copyable_v<Result<std::uint32_t, ErrorSet<ConfigError>>>);
+static_assert(!std::is_copy_constructible_v<Result<std::unique_ptr<int>, ErrorSet<IoError>>>);
+static_assert(std::is_nothrow_move_constructible_v<Result<std::unique_ptr<int>, ErrorSet<ConfigError>>>);
+
+static_assert(!std::is_constructible_v<Result<int, ReadErrors>, feer::SetError<ParseErrors>>);
+static_assert(std::is_constructible_v<Result<int, ParseErrors>, feer::SetError<ReadErrors>>);
+
+static_assert([] {
+    constexpr auto half = [](int x) -> Result<int, ErrorSet<IoError, ParseError>> {
+        if (x % 2 != 0) {
+            return ParseError{static_cast<std::uint32_t>(x)};
+        }
+        return x / 2;
+    };
+    return half(8).value() == 4 && half(3).holds_error<ParseError>() && half(3).error<ParseError>().line == 3;
+}());
+
+TEST_CASE("error set Result holds a value or one error of the set") {
+    const Result<std::uint32_t, ParseErrors> ok = 7U;
+    CHECK(ok.is_ok());
+    CHECK(ok.value() == 7);
+    CHECK(ok.value_or(1U) == 7);
+
+    const Result<std::uint32_t, ParseErrors> io = IoError::denied;
+    CHECK(io.is_err());
+    CHECK_FALSE(io);
+    CHECK(io.holds_error<IoError>());
+    CHECK_FALSE(io.holds_error<ParseError>());
+    CHECK(io.error<IoError>() == IoError::denied);
+    CHECK(io.value_or(1U) == 1);
+    CHECK_THROWS_AS((void)io.value(), std::bad_variant_access);
+    CHECK_THROWS_AS((void)io.error<ParseError>(), std::bad_variant_access);
+    CHECK_THROWS_AS((void)ok.errors(), std::bad_variant_access);
+
+    const feer::SetError<ParseErrors> errors = io.errors();
+    CHECK(errors.holds<IoError>());
+    CHECK(errors.index() == 1);
+}
+
+TEST_CASE("FEER_TRY propagates errors into the wider set of the caller") {
+    CHECK(load("app.conf").value().port == 8080);
+    CHECK(load("missing").error<IoError>() == IoError::not_found);
+    CHECK(load("bad").error<ParseError>().line == 1);
+
+    CHECK(describe(load("app.conf")) == std::string{"ok"});
+    CHECK(describe(load("missing")) == std::string{"io"});
+    CHECK(describe(load("bad")) == std::string{"parse"});
+
+    CHECK(validate("app.conf").is_ok());
+    CHECK(validate("missing").holds_error<IoError>());
+}
+
+TEST_CASE("error set Result keeps its error when moving in a value throws") {
+    Result<ThrowsOnMove, ErrorSet<ConfigError>> target = ConfigError{"kept"};
+    Result<ThrowsOnMove, ErrorSet<ConfigError>> source = ThrowsOnMove{false};
+    source.value().fail = true;
+
+    CHECK_THROWS_AS(target = std::move(source), std::runtime_error);
+    REQUIRE(target.holds_error<ConfigError>());
+    CHECK(target.error<ConfigError>().key == "kept");
+
+    source.value().fail = false;
+    target = std::move(source);
+    CHECK(target.is_ok());
+}
+
+TEST_CASE("error set match is exhaustive and passes ownership to rvalues") {
+    Result<std::unique_ptr<int>, ErrorSet<ConfigError, IoError>> owned = std::make_unique<int>(5);
+    const int value = std::move(owned).match(
+        [](std::unique_ptr<int>&& ptr) { return *ptr; },
+        [](ConfigError&&) { return -1; },
+        [](IoError) { return -2; });
+    CHECK(value == 5);
+
+    Result<int, ErrorSet<ConfigError, IoError>> config = ConfigError{"timeout"};
+    const std::string key = std::move(config).match(
+        [](int&&) { return std::string{}; },
+        [](ConfigError&& err) { return std::move(err.key); },
+        [](IoError) { return std::string{"io"}; });
+    CHECK(key == "timeout");
+
+    const Result<int, ErrorSet<ConfigError, IoError, ParseError>> generic = ParseError{9};
+    CHECK(generic.match([](const int&) { return 0; }, [](const auto&) { return 1; }) == 1);
+}
+
+TEST_CASE("error set Result copies, moves and assigns across states") {
+    using R = Result<std::string, ErrorSet<ConfigError, IoError>>;
+    R a = std::string(64, 'v');
+    R b = ConfigError{std::string(64, 'k')};
+    R c = b;
+    CHECK(c.error<ConfigError>().key == b.error<ConfigError>().key);
+
+    c = a;
+    CHECK(c.value() == a.value());
+    c = std::move(b);
+    CHECK(c.error<ConfigError>().key == std::string(64, 'k'));
+    c = IoError::denied;
+    CHECK(c.holds_error<IoError>());
+    c = R{std::string{"x"}};
+    CHECK(c.value() == "x");
+}
+
+TEST_CASE("error set Result stores references and void") {
+    int target = 1;
+    Result<int&, ErrorSet<IoError>> ref = target;
+    ref.value() = 2;
+    CHECK(target == 2);
+    CHECK(ref.match([](int& v) { return v; }, [](IoError) { return 0; }) == 2);
+
+    Result<void, ErrorSet<IoError>> done;
+    CHECK(done.is_ok());
+    CHECK(done.match([] { return 1; }, [](IoError) { return 0; }) == 1);
+    done = IoError::not_found;
+    CHECK_THROWS_AS(done.value(), std::bad_variant_access);
+}
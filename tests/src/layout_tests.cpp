@@ -0,0 +1,38 @@
+#include <doctest/doctest.h>
+#include <feer/layout.hpp>
+
+#include <array>
+#include <string>
+
+using feer::Result;
+using feer::result_layout;
+
+TEST_CASE("result_layout accounts for every byte") {
+    using layout = result_layout<Result<int>>;
+    CHECK(layout::size == sizeof(Result<int>));
+    CHECK(layout::align == alignof(Result<int>));
+    CHECK(layout::payload_bytes == sizeof(feer::Err));
+    CHECK(layout::size == layout::payload_bytes + layout::tag_bytes + layout::instrumentation_bytes +
+                              layout::padding_bytes);
+
+    using big = result_layout<Result<std::array<char, 256>>>;
+    CHECK(big::boxed == (FEER_BOX_THRESHOLD != 0));
+    CHECK(big::payload_bytes == (big::boxed ? sizeof(feer::Err) : 256));
+    CHECK_FALSE(layout::boxed);
+
+    using ref = result_layout<Result<std::array<char, 256>&>>;
+    CHECK(ref::size == result_layout<Result<int>>::size);
+}
+
+TEST_CASE("result_layout reports Result<void>") {
+    using layout = result_layout<Result<void>>;
+    CHECK(layout::payload_bytes == sizeof(feer::Err));
+    CHECK_FALSE(layout::trivially_copyable);
+    CHECK_FALSE(layout::sysv_register_returnable);
+    CHECK(layout::nothrow_movable);
+}
+
+#if !FEER_CHECK_UNINSPECTED && !FEER_AUDIT_COPIES && !FEER_INTERN_MESSAGES
+static_assert(result_layout<Result<int>>::instrumentation_bytes == 0);
+static_assert(result_layout<Result<std::string>>::size == result_layout<Result<void>>::size);
+#endif
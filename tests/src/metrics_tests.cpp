@@ -0,0 +1,155 @@
+#include <doctest/doctest.h>
+#include <feer/metrics.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace feer;
+
+TEST_CASE("LogHistogram buckets are exact for small values and bounded above") {
+    for (std::uint64_t value = 0; value < 4; ++value) {
+        CHECK(LogHistogram::upper_bound_of(LogHistogram::bucket_of(value)) == value);
+    }
+
+    for (std::uint64_t value : {4ULL, 5ULL, 7ULL, 100ULL, 1000ULL, 123456789ULL, ~0ULL}) {
+        const std::uint64_t upper = LogHistogram::upper_bound_of(LogHistogram::bucket_of(value));
+        CHECK(upper >= value);
+        CHECK(static_cast<double>(upper) <= static_cast<double>(value) * 1.25);
+    }
+
+    CHECK(LogHistogram::bucket_of(~0ULL) < LogHistogram::bucket_count);
+}
+
+TEST_CASE("LogHistogram reports count, percentiles and max") {
+    LogHistogram histogram;
+    CHECK(histogram.count() == 0);
+    CHECK(histogram.percentile(0.5) == 0);
+    CHECK(histogram.max() == 0);
+
+    for (std::uint64_t value = 1; value <= 100; ++value) {
+        histogram.record(value);
+    }
+
+    CHECK(histogram.count() == 100);
+    CHECK(histogram.percentile(0.0) == 1);
+    CHECK(histogram.percentile(0.5) >= 50);
+    CHECK(histogram.percentile(0.5) <= 63);
+    CHECK(histogram.max() >= 100);
+
+    LogHistogram other;
+    other.record(3);
+    histogram.merge(other);
+    CHECK(histogram.count() == 101);
+}
+
+#if FEER_PROPAGATION_METRICS
+
+namespace {
+
+Result<int> origin() {
+    return Err{"deep"};
+}
+
+// Propagates by returning the failed Result itself, which moves it into the caller's Result.
+Result<int> middle() {
+    Result<int> result = origin();
+    if (!result) {
+        return result;
+    }
+    return result.value() + 1;
+}
+
+// Propagates into a Result of another type, which places the Err into a new Result.
+Result<long> outer() {
+    const Result<int> result = middle();
+    if (!result) {
+        return result.error();
+    }
+    return result.value() * 2L;
+}
+
+// Returning the call directly creates no new Result, so it is not a hop.
+Result<long> entry() {
+    return outer();
+}
+
+// Stands in for an error built in a constant expression, which carries no creation timestamp.
+Result<int> compile_time_error() {
+    Err err{"built at compile time"};
+    err.created_ticks = 0;
+    return err;
+}
+
+}  // namespace
+
+TEST_CASE("propagation metrics count hops per construction site") {
+    start_propagation_metrics();
+    for (int i = 0; i < 10; ++i) {
+        CHECK(entry().value_or(-1) == -1);
+    }
+    stop_propagation_metrics();
+
+    bool found = false;
+    for (const PropagationSiteMetrics& site : propagation_metrics()) {
+        if (std::string{site.where.function_name()}.find("origin") == std::string::npos) {
+            continue;
+        }
+        found = true;
+        CHECK(site.hops.count() == 10);
+        CHECK(site.hops.percentile(0.5) == 3);
+        CHECK(site.latency_ticks.count() == 10);
+    }
+    CHECK(found);
+
+    std::ostringstream out;
+    write_propagation_report(out);
+    CHECK(out.str().find("hops[p50=3") != std::string::npos);
+}
+
+TEST_CASE("propagation metrics skip the latency of errors built at compile time") {
+    start_propagation_metrics();
+    CHECK(compile_time_error().value_or(-1) == -1);
+    stop_propagation_metrics();
+
+    bool found = false;
+    for (const PropagationSiteMetrics& site : propagation_metrics()) {
+        if (std::string{site.where.function_name()}.find("compile_time_error") == std::string::npos) {
+            continue;
+        }
+        found = true;
+        CHECK(site.hops.count() == 1);
+        CHECK(site.latency_ticks.count() == 0);
+    }
+    CHECK(found);
+}
+
+TEST_CASE("propagation metrics reuse the tables of exited threads") {
+    const auto origin_count = [] {
+        for (const PropagationSiteMetrics& site : propagation_metrics()) {
+            if (std::string{site.where.function_name()}.find("origin") != std::string::npos) {
+                return site.hops.count();
+            }
+        }
+        return std::uint64_t{0};
+    };
+    const auto record_on_new_thread = [] {
+        std::thread worker{[] { CHECK(entry().value_or(-1) == -1); }};
+        worker.join();
+    };
+
+    start_propagation_metrics();
+    const std::uint64_t before = origin_count();
+    record_on_new_thread();
+    const std::size_t tables = detail::propagation_state().tables.size();
+    for (int i = 0; i < 8; ++i) {
+        record_on_new_thread();
+    }
+    stop_propagation_metrics();
+
+    CHECK(detail::propagation_state().tables.size() == tables);
+    CHECK(origin_count() == before + 9);
+}
+
+#endif
@@ -0,0 +1,114 @@
+#include <doctest/doctest.h>
+#include <feer/nan_boxed.hpp>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+using feer::Err;
+using feer::NanBoxed;
+
+using Boxed = feer::Result<double, NanBoxed>;
+
+namespace {
+
+Boxed safe_sqrt(double x) {
+    if (x < 0.0) {
+        return Err{"negative input"};
+    }
+    return std::sqrt(x);
+}
+
+}  // namespace
+
+static_assert(sizeof(Boxed) == 8);
+static_assert(std::is_trivially_copyable_v<Boxed>);
+static_assert(Boxed{2.5}.value() == 2.5);
+static_assert(Boxed{-0.0}.is_ok());
+static_assert(Boxed{std::numeric_limits<double>::infinity()}.is_ok());
+
+TEST_CASE("NaN-boxed Result holds a double or an interned error") {
+    const Boxed ok = safe_sqrt(4.0);
+    CHECK(ok.is_ok());
+    CHECK(ok.value() == 2.0);
+    CHECK(ok.value_or(-1.0) == 2.0);
+    CHECK_THROWS_AS((void)ok.error(), std::bad_variant_access);
+
+    const Boxed err = safe_sqrt(-4.0);
+    CHECK(err.is_err());
+    CHECK_FALSE(err);
+    CHECK(err.error().message == "negative input");
+    CHECK(err.value_or(-1.0) == -1.0);
+    CHECK_THROWS_AS((void)err.value(), std::bad_variant_access);
+    CHECK(err.match([](double) { return std::string{}; }, [](const Err& e) { return std::string{e.message}; }) == "negative input");
+    CHECK(ok.match([](double v) { return v; }, [](const Err&) { return 0.0; }) == 2.0);
+}
+
+TEST_CASE("NaN-boxed Result interns equal errors once") {
+    const Boxed first = safe_sqrt(-1.0);
+    const Boxed second = safe_sqrt(-2.0);
+    CHECK(first.error_index() == second.error_index());
+    CHECK(&first.error() == &second.error());
+
+    const Boxed other = Err{"other"};
+    CHECK(other.error_index() != first.error_index());
+
+    std::vector<std::uint32_t> indices(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < indices.size(); ++t) {
+        threads.emplace_back([&indices, t] { indices[t] = safe_sqrt(-1.0).error_index(); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (const std::uint32_t index : indices) {
+        CHECK(index == first.error_index());
+    }
+}
+
+#if FEER_ERR_PAYLOADS
+TEST_CASE("NaN-boxed Result drops payloads so equal errors still share an entry") {
+    const auto fail = [](int code) -> Boxed { return Err{"with payload"}.attach(code); };
+    const Boxed first = fail(1);
+    const Boxed second = fail(2);
+    CHECK(first.error_index() == second.error_index());
+    CHECK_FALSE(first.error().has_payload());
+    CHECK(first.error().message == "with payload");
+}
+#endif
+
+TEST_CASE("NaN-boxed error table maps new errors to a fixed entry once full") {
+    CHECK(feer::detail::NanBoxTable::instance().capacity() == FEER_NAN_BOX_MAX_ERRORS);
+
+    feer::detail::NanBoxTable table{4};
+    const auto request_failed = [&table](int id) { return table.intern(Err{"request " + std::to_string(id) + " failed"}); };
+    CHECK(request_failed(0) == 0);
+    CHECK(request_failed(1) == 1);
+    CHECK(request_failed(2) == 2);
+
+    const std::uint32_t full = request_failed(3);
+    CHECK(full == table.full_index());
+    CHECK(full == 3);
+    CHECK(table.get(full).message == "NanBoxed error table is full");
+    CHECK(request_failed(4) == full);
+    CHECK(table.intern(Err{"NanBoxed error table is full"}) == full);
+
+    CHECK(request_failed(1) == 1);
+    CHECK(table.get(1).message == "request 1 failed");
+}
+
+TEST_CASE("NaN-boxed Result keeps NaN values ok") {
+    const Boxed quiet = std::numeric_limits<double>::quiet_NaN();
+    CHECK(quiet.is_ok());
+    CHECK(std::isnan(quiet.value()));
+
+    const Boxed colliding = std::bit_cast<double>(Boxed::error_bits | 7U);
+    CHECK(colliding.is_ok());
+    CHECK(std::isnan(colliding.value()));
+}
@@ -0,0 +1,86 @@
+#include <doctest/doctest.h>
+#include <feer/packed.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+using feer::PackedResult;
+
+namespace {
+
+enum class PortError : std::uint8_t { empty, not_decimal, out_of_range };
+
+constexpr PackedResult<std::uint16_t, PortError> parse_port(std::string_view text) {
+    if (text.empty()) {
+        return PortError::empty;
+    }
+    std::uint32_t port = 0;
+    for (const char c : text) {
+        if (c < '0' || c > '9') {
+            return PortError::not_decimal;
+        }
+        port = port * 10 + static_cast<std::uint32_t>(c - '0');
+        if (port > 65535) {
+            return PortError::out_of_range;
+        }
+    }
+    return static_cast<std::uint16_t>(port);
+}
+
+// Converts to a port, throwing for values that do not fit.
+struct CheckedPort {
+    std::uint32_t value;
+
+    constexpr operator std::uint16_t() const {
+        if (value > 65535) {
+            throw std::out_of_range{"port out of range"};
+        }
+        return static_cast<std::uint16_t>(value);
+    }
+};
+
+}  // namespace
+
+static_assert(noexcept(std::declval<const PackedResult<std::uint16_t, PortError>&>().value_or(80)));
+static_assert(!noexcept(std::declval<const PackedResult<std::uint16_t, PortError>&>().value_or(CheckedPort{80})));
+static_assert(parse_port("").value_or(CheckedPort{8080}) == 8080);
+static_assert(sizeof(PackedResult<std::uint32_t, PortError>) == sizeof(std::uint64_t));
+static_assert(std::is_trivially_copyable_v<PackedResult<float, std::int32_t>>);
+static_assert(parse_port("8080").value() == 8080);
+static_assert(parse_port("99999").error() == PortError::out_of_range);
+static_assert(parse_port("").value_or(80) == 80);
+static_assert(parse_port("x").match([](std::uint16_t) { return 0; }, [](PortError e) { return static_cast<int>(e); }) ==
+              static_cast<int>(PortError::not_decimal));
+
+TEST_CASE("PackedResult holds a value or an error code") {
+    const auto ok = parse_port("443");
+    CHECK(ok.is_ok());
+    CHECK(ok);
+    CHECK(ok.value() == 443);
+    CHECK_THROWS_AS((void)ok.error(), std::bad_variant_access);
+
+    const auto err = parse_port("4x");
+    CHECK(err.is_err());
+    CHECK_THROWS_AS((void)err.value_or(CheckedPort{70000}), std::out_of_range);
+    CHECK(err.error() == PortError::not_decimal);
+    CHECK(err.value_or(1) == 1);
+    CHECK_THROWS_AS((void)err.value(), std::bad_variant_access);
+}
+
+TEST_CASE("PackedResult round-trips values, errors and raw bits") {
+    using Same = PackedResult<std::int32_t, std::int32_t>;
+    CHECK(Same::ok(-1).value() == -1);
+    CHECK(Same::err(-1).error() == -1);
+    CHECK(Same::ok(-1).is_ok());
+
+    const PackedResult<float, std::int32_t> value = -2.5F;
+    CHECK(value.value() == -2.5F);
+
+    const auto err = parse_port("");
+    const auto copy = PackedResult<std::uint16_t, PortError>::from_bits(err.bits());
+    CHECK(copy.error() == PortError::empty);
+}
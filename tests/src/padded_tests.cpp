@@ -0,0 +1,129 @@
+#include <doctest/doctest.h>
+#include <feer/padded.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using feer::Err;
+using feer::PaddedResultArray;
+using feer::PaddedSlot;
+using feer::Result;
+
+static_assert(alignof(PaddedSlot<int>) == feer::cache_line_size);
+static_assert(sizeof(PaddedSlot<int>) % feer::cache_line_size == 0);
+
+namespace {
+
+std::uintptr_t address_of(const auto& object) {
+    return reinterpret_cast<std::uintptr_t>(&object);
+}
+
+std::uintptr_t line_of(const auto& object) {
+    return address_of(object) / feer::cache_line_size;
+}
+
+Result<int> square_even(std::size_t i) {
+    if (i % 2 != 0) {
+        return Err{"odd " + std::to_string(i)};
+    }
+    return static_cast<int>(i * i);
+}
+
+}  // namespace
+
+TEST_CASE("PaddedSlot is empty until written") {
+    PaddedSlot<int> slot;
+    CHECK_FALSE(slot.has_result());
+    CHECK(slot.get() == nullptr);
+    CHECK(slot.take().is_err());
+
+    slot.emplace(7);
+    REQUIRE(slot.has_result());
+    CHECK(slot.get()->value() == 7);
+    CHECK(slot.take().value() == 7);
+    CHECK_FALSE(slot.has_result());
+
+    std::vector<PaddedSlot<int>> slots(3);
+    CHECK(line_of(slots[0]) != line_of(slots[1]));
+}
+
+TEST_CASE("PaddedResultArray puts every slot on its own cache line") {
+    PaddedResultArray<int> results{4};
+    CHECK(results.size() == 4);
+    CHECK(results.chunk_size() == 1);
+    CHECK(results.chunk_count() == 4);
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        results.emplace(i, static_cast<int>(i));
+    }
+    for (std::size_t i = 1; i < results.size(); ++i) {
+        CHECK(line_of(results[i - 1]) != line_of(results[i]));
+    }
+}
+
+TEST_CASE("PaddedResultArray chunks start on cache lines and pack their slots") {
+    PaddedResultArray<int> results{10, 3};
+    CHECK(results.chunk_size() == 4);
+    CHECK(results.chunk_count() == 3);
+    CHECK(results.chunk(2).begin == 8);
+    CHECK(results.chunk(2).end == 10);
+    CHECK(results.chunk(3).begin == results.chunk(3).end);
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        results.emplace(i, static_cast<int>(i));
+    }
+    for (std::size_t c = 0; c < results.chunk_count(); ++c) {
+        const std::size_t begin = results.chunk(c).begin;
+        CHECK(address_of(results[begin]) % feer::cache_line_size == 0);
+        CHECK(address_of(results[begin + 1]) - address_of(results[begin]) == sizeof(std::optional<Result<int>>));
+        if (c > 0) {
+            CHECK(line_of(results[begin - 1]) != line_of(results[begin]));
+        }
+    }
+}
+
+TEST_CASE("PaddedResultArray collects parallel writes into a compact vector") {
+    constexpr std::size_t workers = 4;
+    PaddedResultArray<int> results{101, workers};
+
+    std::vector<std::thread> threads;
+    for (std::size_t w = 0; w < workers; ++w) {
+        threads.emplace_back([&results, w] {
+            const auto [begin, end] = results.chunk(w);
+            for (std::size_t i = begin; i < end; ++i) {
+                results.emplace(i, square_even(i));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<Result<int>> compact = results.compact();
+    REQUIRE(compact.size() == 101);
+    for (std::size_t i = 0; i < compact.size(); ++i) {
+        CHECK(compact[i].is_ok() == (i % 2 == 0));
+    }
+    CHECK(compact[10].value() == 100);
+    CHECK(compact[11].error().message == "odd 11");
+    CHECK_FALSE(results.has_result(10));
+}
+
+TEST_CASE("PaddedResultArray reports slots that were never written") {
+    PaddedResultArray<std::string> results{3};
+    results.emplace(0, std::string{"zero"});
+    results.emplace(2, Err{"failed"});
+
+    PaddedResultArray<std::string> moved = std::move(results);
+    CHECK(results.size() == 0);
+
+    std::vector<Result<std::string>> compact = moved.compact();
+    CHECK(compact[0].value() == "zero");
+    CHECK(compact[1].error().message == "PaddedResultArray slot 1 was never written");
+    CHECK(compact[2].error().message == "failed");
+}
@@ -0,0 +1,92 @@
+#include <doctest/doctest.h>
+#include <feer/report.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace feer;
+using namespace std::chrono_literals;
+
+namespace {
+
+std::vector<std::string>& captured() {
+    static std::vector<std::string> messages;
+    return messages;
+}
+
+void capture_sink(const Err& err) {
+    captured().push_back(err.message);
+}
+
+struct CaptureScope {
+    CaptureScope() {
+        captured().clear();
+        previous = set_err_sink(&capture_sink);
+    }
+    ~CaptureScope() { set_err_sink(previous); }
+
+    ErrSink previous;
+};
+
+RateLimiter::clock::time_point at(std::chrono::milliseconds offset) {
+    return RateLimiter::clock::time_point{std::chrono::hours{1} + offset};
+}
+
+bool report_from_one_site(const Result<int>& result) {
+    return FEER_REPORT_ERR_RATE_LIMITED(result, 3);
+}
+
+}  // namespace
+
+TEST_CASE("report_err forwards errors to the installed sink") {
+    CaptureScope scope;
+
+    Result<int> ok = 1;
+    Result<int> err = Err{"reported"};
+
+    CHECK_FALSE(report_err(ok));
+    CHECK(report_err(err));
+    report_err(Err{"direct"});
+
+    REQUIRE(captured().size() == 2);
+    CHECK(captured()[0] == "reported");
+    CHECK(captured()[1] == "direct");
+}
+
+TEST_CASE("set_err_sink returns the previous sink") {
+    const ErrSink original = set_err_sink(&capture_sink);
+    CHECK(set_err_sink(original) == &capture_sink);
+}
+
+TEST_CASE("RateLimiter admits a burst then the sustained rate") {
+    RateLimiter limiter{4};
+
+    CHECK(limiter.try_acquire(at(0ms)));
+    CHECK(limiter.try_acquire(at(0ms)));
+    CHECK(limiter.try_acquire(at(0ms)));
+    CHECK(limiter.try_acquire(at(0ms)));
+    CHECK_FALSE(limiter.try_acquire(at(0ms)));
+    CHECK_FALSE(limiter.try_acquire(at(100ms)));
+
+    CHECK(limiter.try_acquire(at(250ms)));
+    CHECK_FALSE(limiter.try_acquire(at(260ms)));
+
+    CHECK(limiter.try_acquire(at(5000ms)));
+}
+
+TEST_CASE("FEER_REPORT_ERR_RATE_LIMITED limits each call site") {
+    CaptureScope scope;
+
+    Result<int> err = Err{"storm"};
+    int reported = 0;
+    for (int i = 0; i < 100; ++i) {
+        reported += report_from_one_site(err) ? 1 : 0;
+    }
+
+    CHECK(reported == 3);
+    CHECK(captured().size() == 3);
+
+    CHECK(FEER_REPORT_ERR_RATE_LIMITED(err, 1));
+    CHECK_FALSE(FEER_REPORT_ERR_RATE_LIMITED(Result<int>{5}, 1));
+}
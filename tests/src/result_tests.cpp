@@ -3,10 +3,16 @@
 #include <doctest/doctest.h>
 #include <feer/result.hpp>
 
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace {
 
@@ -20,6 +26,27 @@ struct MoveOnly {
     int payload;
 };
 
+struct ThrowsOnTransfer {
+    explicit ThrowsOnTransfer(bool in_fail) : fail(in_fail) {}
+
+    ThrowsOnTransfer(const ThrowsOnTransfer& other) : fail(other.fail) {
+        if (fail) {
+            throw std::runtime_error{"copy failed"};
+        }
+    }
+
+    ThrowsOnTransfer(ThrowsOnTransfer&& other) : fail(other.fail) {
+        if (fail) {
+            throw std::runtime_error{"move failed"};
+        }
+    }
+
+    ThrowsOnTransfer& operator=(const ThrowsOnTransfer&) = default;
+    ThrowsOnTransfer& operator=(ThrowsOnTransfer&&) = default;
+
+    bool fail;
+};
+
 feer::Result<int> always_ok() {
     return 123;
 }
@@ -35,6 +62,35 @@ feer::Result<void> init_with_ok_helper(bool ok) {
     return feer::Err{"init failed"};
 }
 
+feer::Result<int> parse_digit(char c) {
+    if (c < '0' || c > '9') {
+        return feer::Err{"not a digit"};
+    }
+    return c - '0';
+}
+
+feer::Result<void> check_even(int value) {
+    if (value % 2 != 0) {
+        return feer::Err{"odd"};
+    }
+    return feer::Ok();
+}
+
+feer::Result<std::string> describe_digit(char c) {
+    const int digit = FEER_TRY(parse_digit(c));
+    FEER_TRY(check_even(digit));
+    return std::string(static_cast<std::size_t>(digit), '*');
+}
+
+feer::Result<long> widen(feer::Result<int> result) {
+    return FEER_TRY(std::move(result));
+}
+
+feer::Result<std::size_t> length_of(feer::Result<std::string>& text) {
+    const std::string copy = FEER_TRY(text);
+    return copy.size();
+}
+
 }  // namespace
 
 using namespace feer;
@@ -145,6 +201,83 @@ TEST_CASE("Result<T> supports move-only payloads") {
     CHECK(result.value().payload == 99);
 }
 
+TEST_CASE("Result<T> copies, moves and assigns across states") {
+    static_assert(!std::is_copy_constructible_v<Result<MoveOnly>>);
+    static_assert(std::is_nothrow_move_constructible_v<Result<std::string>>);
+
+    const Result<std::string> ok = std::string{"value"};
+    const Result<std::string> err = Err{"failure"};
+    REQUIRE(err.is_err());
+
+    Result<std::string> target = ok;
+    CHECK(target.value() == "value");
+
+    target = err;
+    REQUIRE(target.is_err());
+    CHECK(target.error().message == "failure");
+
+    target = Result<std::string>{std::string{"again"}};
+    REQUIRE(target.is_ok());
+    CHECK(target.value() == "again");
+
+    Result<std::string> moved = std::move(target);
+    CHECK(moved.value() == "again");
+
+    moved = Result<std::string>{Err{"replaced"}};
+    REQUIRE(moved.is_err());
+    CHECK(moved.error().message == "replaced");
+
+    Result<MoveOnly> move_only = Err{"empty"};
+    move_only = Result<MoveOnly>{MoveOnly{7}};
+    CHECK(move_only.value().payload == 7);
+}
+
+TEST_CASE("Result<T> keeps its error when assigning a value that throws") {
+    static_assert(!std::is_nothrow_move_constructible_v<Result<ThrowsOnTransfer>>);
+
+    Result<ThrowsOnTransfer> target = Err{"kept"};
+    Result<ThrowsOnTransfer> source = ThrowsOnTransfer{false};
+    source.value().fail = true;
+
+    CHECK_THROWS_AS(target = source, std::runtime_error);
+    REQUIRE(target.is_err());
+    CHECK(target.error().message == "kept");
+
+    CHECK_THROWS_AS(target = std::move(source), std::runtime_error);
+    REQUIRE(target.is_err());
+    CHECK(target.error().message == "kept");
+
+    source.value().fail = false;
+    target = std::move(source);
+    CHECK(target.is_ok());
+}
+
+TEST_CASE("FEER_TRY unwraps values and returns errors of plain Results") {
+    CHECK(describe_digit('4').value() == "****");
+    CHECK(describe_digit('x').error().message == "not a digit");
+    CHECK(describe_digit('3').error().message == "odd");
+}
+
+TEST_CASE("FEER_TRY moves errors out of temporaries") {
+    static_assert(std::is_same_v<decltype(feer::detail::try_error(std::declval<Result<int>&&>())), Err&&>);
+    static_assert(std::is_same_v<decltype(std::declval<Result<void>&&>().error()), Err&&>);
+
+    Result<int> failed = Err{std::string(64, 'x')};
+    const char* message = failed.error().message.data();
+    const Result<long> widened = widen(std::move(failed));
+    CHECK(widened.error().message.data() == message);
+}
+
+TEST_CASE("FEER_TRY leaves a named Result unchanged") {
+    Result<std::string> text = std::string(32, 'y');
+    CHECK(length_of(text).value() == 32);
+    CHECK(text.value() == std::string(32, 'y'));
+
+    Result<std::string> failed = Err{"missing"};
+    CHECK(length_of(failed).error().message == "missing");
+    CHECK(failed.error().message == "missing");
+}
+
 TEST_CASE("Result<T> provides correct value() reference categories") {
     static_assert(std::is_same_v<decltype(std::declval<Result<int>&>().value()), int&>);
     static_assert(std::is_same_v<decltype(std::declval<const Result<int>&>().value()), const int&>);
@@ -293,3 +426,540 @@ TEST_CASE("Err captures source_location") {
         CHECK(std::string{err.where.file_name()} == call_site.file_name());
     }
 }
+
+namespace {
+
+int g_hook_calls = 0;
+std::string g_hook_last_message;
+
+void counting_hook(const Err& err) {
+    ++g_hook_calls;
+    g_hook_last_message = err.message;
+}
+
+}  // namespace
+
+TEST_CASE("Err hook observes every construction while installed") {
+    g_hook_calls = 0;
+    CHECK(set_err_hook(&counting_hook) == nullptr);
+
+    Result<int> result = Err{"hooked"};
+    const Err copy = result.error();
+    static_cast<void>(copy);
+
+    CHECK(g_hook_calls == 1);
+    CHECK(g_hook_last_message == "hooked");
+
+    CHECK(set_err_hook(nullptr) == &counting_hook);
+
+    const Err unobserved{"not-hooked"};
+    static_cast<void>(unobserved);
+    CHECK(g_hook_calls == 1);
+}
+
+#if FEER_CHECK_UNINSPECTED
+
+namespace {
+
+int g_uninspected_calls = 0;
+
+void counting_uninspected_hook(const Err&) {
+    ++g_uninspected_calls;
+}
+
+}  // namespace
+
+TEST_CASE("destroying an uninspected error Result is reported") {
+    g_uninspected_calls = 0;
+    const ErrHook previous = set_uninspected_err_hook(&counting_uninspected_hook);
+
+    {
+        Result<int> ignored = Err{"ignored"};
+        Result<void> ignored_void = Err{"ignored-void"};
+        Result<int> ignored_ok = 1;
+    }
+    CHECK(g_uninspected_calls == 2);
+
+    {
+        Result<int> checked = Err{"checked"};
+        CHECK_FALSE(checked.is_ok());
+
+        Result<int> moved_from = Err{"moved"};
+        Result<int> moved_to = std::move(moved_from);
+        CHECK(moved_to.value_or(3) == 3);
+
+        Result<int> copied = moved_to;
+        static_cast<void>(copied);
+    }
+    CHECK(g_uninspected_calls == 3);
+
+    set_uninspected_err_hook(previous);
+}
+
+#endif
+
+#if FEER_AUDIT_COPIES
+
+namespace {
+
+std::string read_copy_audit() {
+    std::FILE* file = std::tmpfile();
+    write_copy_audit(file);
+    std::rewind(file);
+
+    std::string text;
+    char buffer[256];
+    while (std::fgets(buffer, sizeof(buffer), file) != nullptr) {
+        text += buffer;
+    }
+    std::fclose(file);
+    return text;
+}
+
+}  // namespace
+
+static_assert(noexcept(std::declval<feer::detail::CopyAudit&>().record(
+    std::source_location::current(), std::string_view{"move"}, std::string_view{"int"}, true)));
+static_assert(std::is_nothrow_move_constructible_v<Result<std::string>>);
+
+TEST_CASE("copy audit counts copies and moves per construction site") {
+    reset_copy_audit();
+
+    const std::string payload = "payload";
+    Result<std::string> copied_in = payload;
+    Result<std::string> copy_of = copied_in;
+    const std::string out = copy_of.value_or("fallback");
+    static_cast<void>(out);
+
+    const std::string report = read_copy_audit();
+    const std::string type{detail::type_name<std::string>()};
+    CHECK(report.find("construct " + type + " copies=1 moves=0") != std::string::npos);
+    CHECK(report.find("copy " + type + " copies=1 moves=0") != std::string::npos);
+    CHECK(report.find("value_or " + type + " copies=1 moves=0") != std::string::npos);
+
+    reset_copy_audit();
+}
+
+#endif
+
+TEST_CASE("match passes const access to lvalues and ownership to rvalues") {
+    struct Probe {
+        int operator()(const std::string&) const { return 1; }
+        int operator()(std::string&) const { return 2; }
+        int operator()(std::string&&) const { return 3; }
+    };
+    const auto on_err = [](const Err&) { return 0; };
+
+    Result<std::string> result = std::string{"feer"};
+    const Result<std::string>& const_result = result;
+
+    CHECK(result.match(Probe{}, on_err) == 1);
+    CHECK(const_result.match(Probe{}, on_err) == 1);
+    CHECK(std::move(result).match(Probe{}, on_err) == 3);
+
+    std::string target = "alias";
+    Result<std::string&> ref_result{target};
+    CHECK(std::move(ref_result).match(Probe{}, on_err) == 2);
+
+    Result<std::string> source = std::string{"moved"};
+    CHECK(std::move(source).value_or(std::string{}) == "moved");
+}
+
+TEST_CASE("value and match follow the value category of the Result") {
+    static_assert(std::is_same_v<decltype(std::declval<Result<int>&>().value()), int&>);
+    static_assert(std::is_same_v<decltype(std::declval<const Result<int>&>().value()), const int&>);
+    static_assert(std::is_same_v<decltype(std::declval<Result<int>&&>().value()), int&&>);
+    static_assert(std::is_same_v<decltype(std::declval<const Result<int>&&>().value()), const int&>);
+    static_assert(std::is_same_v<decltype(std::declval<Result<int&>&&>().value()), int&>);
+    static_assert(std::is_same_v<decltype(std::declval<const Result<int&>&>().value()), int&>);
+
+    struct ErrProbe {
+        int operator()(const Err&) const { return 1; }
+        int operator()(Err&&) const { return 2; }
+    };
+    const auto on_ok = [] { return 0; };
+
+    Result<void> failed = Err{"failure"};
+    const Result<void>& const_failed = failed;
+    CHECK(failed.match(on_ok, ErrProbe{}) == 1);
+    CHECK(std::move(const_failed).match(on_ok, ErrProbe{}) == 1);
+    CHECK(std::move(failed).match(on_ok, ErrProbe{}) == 2);
+
+    const Result<std::string> kept = std::string{"kept"};
+    CHECK(std::move(kept).value_or(std::string{}) == "kept");
+    CHECK(kept.value() == "kept");
+}
+
+namespace {
+
+struct CountingPolicy : feer::DefaultPolicy {
+    static inline int propagated_count = 0;
+    static inline int handled_count = 0;
+
+    static void propagated(Err&) noexcept { ++propagated_count; }
+    static void handled(const Err&) noexcept { ++handled_count; }
+};
+
+struct BoxedPolicy : feer::DefaultPolicy {
+    static constexpr feer::ValueStorage storage = feer::ValueStorage::boxed;
+};
+
+struct InlinePolicy : feer::DefaultPolicy {
+    static constexpr feer::ValueStorage storage = feer::ValueStorage::inline_value;
+};
+
+struct UncheckedPolicy : feer::DefaultPolicy {
+    static constexpr feer::AccessCheck access = feer::AccessCheck::unchecked;
+};
+
+struct AbortingPolicy : feer::DefaultPolicy {
+    static constexpr feer::AccessCheck access = feer::AccessCheck::aborts;
+};
+
+struct Wide {
+    char bytes[512];
+};
+
+constexpr int unchecked_sum() {
+    const feer::BasicResult<int, Err, UncheckedPolicy> ok = 40;
+    const feer::BasicResult<int, Err, UncheckedPolicy> err = Err{"no"};
+    return ok.value() + (err.is_err() ? 2 : 0);
+}
+
+}  // namespace
+
+static_assert(std::is_same_v<Result<int>, feer::BasicResult<int, Err, feer::DefaultPolicy>>);
+static_assert(std::is_same_v<Result<void>, feer::BasicResult<void>>);
+static_assert(sizeof(feer::BasicResult<Wide, Err, BoxedPolicy>) == sizeof(feer::BasicResult<int, Err, BoxedPolicy>));
+static_assert(sizeof(feer::BasicResult<Wide, Err, InlinePolicy>) > sizeof(Wide));
+static_assert(sizeof(feer::BasicResult<int, Err, UncheckedPolicy>) == sizeof(Result<int>));
+static_assert(unchecked_sum() == 42);
+
+TEST_CASE("policies select instrumentation hooks") {
+    CountingPolicy::propagated_count = 0;
+    CountingPolicy::handled_count = 0;
+
+    const feer::BasicResult<int, Err, CountingPolicy> failed = Err{"counted"};
+    const feer::BasicResult<void, Err, CountingPolicy> void_failed = Err{"counted"};
+    CHECK(CountingPolicy::propagated_count == 2);
+
+    CHECK(failed.value_or(7) == 7);
+    CHECK(void_failed.match([] { return 0; }, [](const Err&) { return 1; }) == 1);
+    CHECK(CountingPolicy::handled_count == 2);
+
+    const feer::BasicResult<int, Err, CountingPolicy> ok = 3;
+    CHECK(ok.value_or(7) == 3);
+    CHECK(CountingPolicy::handled_count == 2);
+}
+
+TEST_CASE("policies select storage and access checking") {
+    feer::BasicResult<Wide, Err, BoxedPolicy> boxed = Wide{{'w'}};
+    const char* bytes = boxed.value().bytes;
+    const feer::BasicResult<Wide, Err, BoxedPolicy> moved = std::move(boxed);
+    CHECK(moved.value().bytes == bytes);
+    CHECK(moved.value().bytes[0] == 'w');
+    REQUIRE(boxed.is_ok());
+    CHECK_THROWS_AS(static_cast<void>(boxed.value()), std::bad_variant_access);
+    CHECK(boxed.value_or(Wide{{'f'}}).bytes[0] == 'f');
+
+    const feer::BasicResult<std::string, Err, AbortingPolicy> aborting = std::string{"fine"};
+    CHECK(aborting.value() == "fine");
+
+    const feer::BasicResult<std::string, Err, UncheckedPolicy> unchecked = Err{"unchecked"};
+    CHECK(unchecked.error().message == "unchecked");
+
+    const Result<std::string> throwing = std::string{"value"};
+    CHECK_THROWS_AS(static_cast<void>(throwing.error()), std::bad_variant_access);
+}
+
+#if FEER_ERR_PAYLOADS
+
+namespace {
+
+struct HttpFailure {
+    int status;
+    std::string body;
+};
+
+Result<int> fetch_rate_limited() {
+    return Err{"rate limited"}.attach(std::chrono::seconds{30});
+}
+
+struct CopyCounter {
+    static inline int copies = 0;
+
+    CopyCounter() = default;
+    CopyCounter(const CopyCounter&) noexcept { ++copies; }
+    CopyCounter(CopyCounter&&) noexcept = default;
+    CopyCounter& operator=(const CopyCounter&) noexcept {
+        ++copies;
+        return *this;
+    }
+    CopyCounter& operator=(CopyCounter&&) noexcept = default;
+};
+
+}  // namespace
+
+TEST_CASE("Err payloads are typed and absent by default") {
+    const Err plain{"plain"};
+    CHECK_FALSE(plain.has_payload());
+    CHECK(plain.payload<int>() == nullptr);
+
+    const Result<int> result = fetch_rate_limited();
+    REQUIRE(result.is_err());
+    REQUIRE(result.error().has_payload());
+    REQUIRE(result.error().payload<std::chrono::seconds>() != nullptr);
+    CHECK(*result.error().payload<std::chrono::seconds>() == std::chrono::seconds{30});
+    CHECK(result.error().payload<const std::chrono::seconds>() == result.error().payload<std::chrono::seconds>());
+    CHECK(result.error().payload<std::chrono::milliseconds>() == nullptr);
+    CHECK(result.error().payload<long long>() == nullptr);
+}
+
+TEST_CASE("FEER_TRY copies an Err only when propagating from a named Result") {
+    Result<int> failed = Err{"counted"}.attach(CopyCounter{});
+    CopyCounter::copies = 0;
+    const Result<long> widened = widen(std::move(failed));
+    REQUIRE(widened.error().payload<CopyCounter>() != nullptr);
+    CHECK(CopyCounter::copies == 0);
+
+    Result<std::string> named = Err{"counted"}.attach(CopyCounter{});
+    CHECK(length_of(named).is_err());
+    CHECK(CopyCounter::copies == 1);
+}
+
+TEST_CASE("Err payloads survive copy, move and replacement") {
+    Err err{"upstream failed"};
+    err.attach(HttpFailure{503, std::string(64, 'x')});
+
+    const Err copy = err;
+    REQUIRE(copy.payload<HttpFailure>() != nullptr);
+    CHECK(copy.payload<HttpFailure>()->status == 503);
+    CHECK(copy.payload<HttpFailure>() != err.payload<HttpFailure>());
+
+    const Err moved = std::move(err);
+    REQUIRE(moved.payload<HttpFailure>() != nullptr);
+    CHECK(moved.payload<HttpFailure>()->body.size() == 64);
+
+    Err reassigned{"other"};
+    reassigned.attach(std::array<int, 2>{1, 2});
+    reassigned = copy;
+    CHECK(reassigned.payload<std::array<int, 2>>() == nullptr);
+    REQUIRE(reassigned.payload<HttpFailure>() != nullptr);
+    CHECK(reassigned.payload<HttpFailure>()->status == 503);
+
+    reassigned.attach(7);
+    CHECK(reassigned.payload<HttpFailure>() == nullptr);
+    REQUIRE(reassigned.payload<int>() != nullptr);
+    CHECK(*reassigned.payload<int>() == 7);
+}
+
+TEST_CASE("Err payloads can be replaced by a value read from the current payload") {
+    Err err{"upstream failed"};
+    err.attach(std::string(64, 'x'));
+    err.attach(*err.payload<std::string>());
+    REQUIRE(err.payload<std::string>() != nullptr);
+    CHECK(*err.payload<std::string>() == std::string(64, 'x'));
+
+    err.attach(HttpFailure{503, "retry later"});
+    err.attach(err.payload<HttpFailure>()->body);
+    REQUIRE(err.payload<std::string>() != nullptr);
+    CHECK(*err.payload<std::string>() == "retry later");
+
+    err.attach(std::array<int, 2>{4, 2});
+    err.attach((*err.payload<std::array<int, 2>>())[0]);
+    REQUIRE(err.payload<int>() != nullptr);
+    CHECK(*err.payload<int>() == 4);
+}
+
+#if FEER_ERR_NODE_POOL
+
+TEST_CASE("heap payloads are recycled by the thread that freed them") {
+    const HttpFailure* first = nullptr;
+    {
+        const Err err = Err{"first"}.attach(HttpFailure{500, "body"});
+        first = err.payload<HttpFailure>();
+    }
+    const Err err = Err{"second"}.attach(HttpFailure{502, "body"});
+    CHECK(err.payload<HttpFailure>() == first);
+}
+
+TEST_CASE("heap payloads can be freed on other threads") {
+    std::vector<Err> produced;
+    for (int i = 0; i < 1000; ++i) {
+        produced.push_back(Err{"storm"}.attach(HttpFailure{i, std::string(40, 'x')}));
+    }
+
+    std::thread consumer{[&produced] { produced.clear(); }};
+    consumer.join();
+
+    using feer::detail::ErrNodePool;
+    const Err leftover = Err{"leftover"}.attach(HttpFailure{0, {}});
+    const Err adopting = Err{"adopting"}.attach(HttpFailure{0, {}});
+    CHECK(ErrNodePool::cached(sizeof(HttpFailure)) > 0);
+    CHECK(ErrNodePool::cached(sizeof(HttpFailure)) < ErrNodePool::max_cached);
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            produced.push_back(Err{"storm"}.attach(HttpFailure{i, {}}));
+        }
+        CHECK(produced.back().payload<HttpFailure>()->status == 999);
+        produced.clear();
+    }
+}
+
+#endif
+
+#endif
+
+#if FEER_INTERN_MESSAGES
+
+TEST_CASE("interned messages share one copy per distinct text") {
+    const std::string dynamic = "connection reset by peer: " + std::to_string(10);
+    const Err first{dynamic};
+    const std::size_t interned = InternedString::table_size();
+    const Err second{"connection reset by peer: 10"};
+
+    CHECK(InternedString::table_size() == interned);
+    CHECK(first.message.data() == second.message.data());
+    CHECK(first.message == second.message);
+    CHECK(first.message == "connection reset by peer: 10");
+    CHECK(first.message != Err{"connection reset by peer: 11"}.message);
+
+    const Err copy = first;
+    CHECK(copy.message.data() == first.message.data());
+    CHECK(copy.message.str() == dynamic);
+}
+
+TEST_CASE("interned messages are removed with their last handle") {
+    const std::size_t before = InternedString::table_size();
+    {
+        const Err once{"peer 10.0.0." + std::to_string(42) + " went away"};
+        const Err copy = once;
+        CHECK(InternedString::table_size() == before + 1);
+    }
+    CHECK(InternedString::table_size() == before);
+
+    const Err again{"peer 10.0.0.42 went away"};
+    CHECK(again.message == "peer 10.0.0.42 went away");
+    CHECK(InternedString::table_size() == before + 1);
+}
+
+TEST_CASE("interning from many threads yields one entry") {
+    const Err held{"interned from 8 threads"};
+    std::vector<const char*> seen(8);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < seen.size(); ++i) {
+        threads.emplace_back([&seen, i] { seen[i] = Err{"interned from " + std::to_string(8) + " threads"}.message.data(); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (const char* data : seen) {
+        CHECK(data == held.message.data());
+    }
+}
+
+#endif
+
+#if FEER_BOX_THRESHOLD
+
+namespace {
+
+struct Frame {
+    std::array<std::uint64_t, 64> words{};
+};
+
+struct SmallButBoxed {
+    int value;
+};
+
+Result<Frame> make_frame(std::uint64_t seed) {
+    if (seed == 0) {
+        return Err{"no frame"};
+    }
+    Frame frame;
+    frame.words.fill(seed);
+    return frame;
+}
+
+Result<Frame> forward_frame(std::uint64_t seed) {
+    Result<Frame> frame = make_frame(seed);
+    if (frame.is_err()) {
+        return std::move(frame.error());
+    }
+    return frame;
+}
+
+}  // namespace
+
+template <>
+inline constexpr bool feer::box_value<SmallButBoxed> = true;
+
+static_assert(feer::box_value<Frame>);
+static_assert(!feer::box_value<int>);
+static_assert(sizeof(Result<Frame>) == sizeof(Result<int>));
+static_assert(sizeof(Result<SmallButBoxed>) == sizeof(Result<Frame>));
+static_assert(std::is_nothrow_move_constructible_v<Result<Frame>>);
+
+TEST_CASE("large success values are boxed and moved by pointer") {
+    Result<Frame> frame = forward_frame(7);
+    REQUIRE(frame.is_ok());
+    CHECK(frame.value().words[63] == 7);
+
+    const std::uint64_t* words = frame.value().words.data();
+    Result<Frame> moved = std::move(frame);
+    CHECK(moved.value().words.data() == words);
+
+    const Result<Frame> copy = moved;
+    CHECK(copy.value().words.data() != words);
+    CHECK(copy.value().words[0] == 7);
+
+    Result<Frame> failed = forward_frame(0);
+    REQUIRE(failed.is_err());
+    CHECK(failed.error().message == "no frame");
+
+    failed = copy;
+    REQUIRE(failed.is_ok());
+    CHECK(failed.value().words[1] == 7);
+
+    const Frame out = std::move(moved).value_or(Frame{});
+    CHECK(out.words[2] == 7);
+
+    const Result<SmallButBoxed> small = SmallButBoxed{3};
+    CHECK(small.value().value == 3);
+}
+
+TEST_CASE("a moved-from boxed Result falls back in value_or and rejects value and match") {
+    Result<Frame> source = forward_frame(5);
+    const Result<Frame> target = std::move(source);
+    CHECK(target.value().words[0] == 5);
+
+    REQUIRE(source.is_ok());
+    CHECK_THROWS_AS(static_cast<void>(std::as_const(source).value()), std::bad_variant_access);
+    CHECK_THROWS_AS(static_cast<void>(source.value()), std::bad_variant_access);
+
+    Frame fallback;
+    fallback.words.fill(3);
+    CHECK(source.value_or(fallback).words[0] == 3);
+    CHECK(std::move(source).value_or(fallback).words[1] == 3);
+
+    bool handler_ran = false;
+    const auto on_ok = [&handler_ran](const Frame&) { handler_ran = true; return 0; };
+    const auto on_err = [&handler_ran](const Err&) { handler_ran = true; return 1; };
+    CHECK_THROWS_AS(static_cast<void>(source.match(on_ok, on_err)), std::bad_variant_access);
+    CHECK_THROWS_AS(static_cast<void>(std::move(source).match(on_ok, on_err)), std::bad_variant_access);
+    CHECK_FALSE(handler_ran);
+
+    Result<Frame> copy = source;
+    CHECK_THROWS_AS(static_cast<void>(copy.value()), std::bad_variant_access);
+    copy = target;
+    CHECK(copy.value().words[1] == 5);
+    copy = source;
+    CHECK_THROWS_AS(static_cast<void>(copy.value()), std::bad_variant_access);
+
+    source = target;
+    CHECK(source.value().words[2] == 5);
+}
+
+#endif
@@ -0,0 +1,73 @@
+#include <doctest/doctest.h>
+#include <feer/simd.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <variant>
+
+using feer::SimdResult;
+
+namespace {
+
+enum class FieldError : std::uint8_t { none, negative, too_large };
+
+constexpr FieldError check_price(float price) {
+    if (price < 0.0F) {
+        return FieldError::negative;
+    }
+    return price > 1000.0F ? FieldError::too_large : FieldError::none;
+}
+
+}  // namespace
+
+static_assert(alignof(SimdResult<float, 16>) == 64);
+static_assert([] {
+    SimdResult<int, 4> lanes{{1, 2, 3, 4}};
+    lanes.validate([](int v) { return v % 2 == 0 ? 0U : 7U; });
+    return lanes.first_err_lane() == 0 && lanes.err_count() == 2 && lanes.value(1) == 2;
+}());
+
+TEST_CASE("SimdResult validates lanes without losing per-lane errors") {
+    SimdResult<float, 8, FieldError> prices{{1.0F, -2.0F, 3.0F, 5000.0F, 4.0F, 5.0F, 6.0F, -1.0F}};
+    CHECK(prices.all_ok());
+    CHECK(prices.first_err_lane() == prices.size());
+
+    prices.validate(check_price);
+    CHECK_FALSE(prices.all_ok());
+    CHECK(prices.err_count() == 3);
+    CHECK(prices.first_err_lane() == 1);
+    CHECK(prices.error(1) == FieldError::negative);
+    CHECK(prices.error(3) == FieldError::too_large);
+    CHECK(prices.value(2) == 3.0F);
+    CHECK(prices.ok_mask().to_ulong() == 0b0111'0101UL);
+    CHECK_THROWS_AS((void)prices.value(7), std::bad_variant_access);
+    CHECK_THROWS_AS((void)prices.error(0), std::bad_variant_access);
+
+    prices.validate([](float) { return FieldError::too_large; });
+    CHECK(prices.error(1) == FieldError::negative);
+}
+
+TEST_CASE("SimdResult map and value_or blend by lane") {
+    SimdResult<int, 4> lanes{{10, 20, 30, 40}, {0, 5, 0, 0}};
+    CHECK(lanes.values()[1] == 0);
+
+    const SimdResult<double, 4> halves = lanes.map([](int v) { return v / 2.0; });
+    CHECK(halves.value(0) == 5.0);
+    CHECK(halves.is_err(1));
+    CHECK(halves.error(1) == 5);
+
+    CHECK(lanes.value_or(-1) == std::array<int, 4>{10, -1, 30, 40});
+    CHECK(lanes.value_or(std::array<int, 4>{1, 2, 3, 4}) == std::array<int, 4>{10, 2, 30, 40});
+
+    lanes.set_err(3, 9);
+    lanes.set_ok(1, 21);
+    CHECK(lanes.first_err_lane() == 3);
+    CHECK(lanes.value(1) == 21);
+
+    CHECK_THROWS_AS(lanes.set_err(1, SimdResult<int, 4>::ok_code), std::invalid_argument);
+    CHECK(lanes.value(1) == 21);
+    CHECK_THROWS_AS(lanes.set_err(3, 0), std::invalid_argument);
+    CHECK(lanes.error(3) == 9);
+}
@@ -0,0 +1,185 @@
+#include <doctest/doctest.h>
+#include <feer/trace.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace feer;
+
+namespace {
+
+std::size_t count_occurrences(const std::string& text, const std::string& needle) {
+    std::size_t count = 0;
+    for (std::size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+Result<int> failing_step() {
+    return Err{"traced \"failure\""};
+}
+
+int handle_once() {
+    return failing_step().match([](int value) { return value; }, [](const Err&) { return -1; });
+}
+
+int g_chained_calls = 0;
+
+void chained_hook(const Err&) {
+    ++g_chained_calls;
+}
+
+}  // namespace
+
+TEST_CASE("error trace records creation and handling as Chrome trace events") {
+    clear_err_trace();
+    start_err_trace(64);
+
+    CHECK(handle_once() == -1);
+    std::thread worker{[] {
+        static_cast<void>(handle_once());
+        static_cast<void>(failing_step().value_or(0));
+    }};
+    worker.join();
+
+    stop_err_trace();
+    CHECK(handle_once() == -1);
+
+    std::ostringstream out;
+    write_chrome_trace(out);
+    const std::string json = out.str();
+
+    CHECK(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0) == 0);
+    CHECK(json.back() == '}');
+    CHECK(count_occurrences(json, "\"name\":\"err_created\"") == 3);
+    CHECK(count_occurrences(json, "\"name\":\"err_handled\"") == 3);
+    CHECK(count_occurrences(json, "\"ph\":\"i\"") == 6);
+    CHECK(json.find("trace_tests.cpp") != std::string::npos);
+    CHECK(json.find("failing_step") != std::string::npos);
+    CHECK(err_trace_dropped() == 0);
+}
+
+TEST_CASE("error trace counts events beyond the thread buffer as dropped") {
+    clear_err_trace();
+    start_err_trace(4);
+
+    std::thread worker{[] {
+        for (int i = 0; i < 10; ++i) {
+            static_cast<void>(handle_once());
+        }
+    }};
+    worker.join();
+
+    stop_err_trace();
+
+    CHECK(err_trace_dropped() == 16);
+    clear_err_trace();
+    CHECK(err_trace_dropped() == 0);
+}
+
+TEST_CASE("error trace chains to previously installed hooks") {
+    g_chained_calls = 0;
+    set_err_hook(&chained_hook);
+
+    start_err_trace();
+    CHECK(handle_once() == -1);
+    stop_err_trace();
+
+    CHECK(g_chained_calls == 1);
+    CHECK(set_err_hook(nullptr) == &chained_hook);
+    clear_err_trace();
+}
+
+TEST_CASE("concurrent starts of the error trace install its hooks once") {
+    g_chained_calls = 0;
+    set_err_hook(&chained_hook);
+
+    std::vector<std::thread> starters;
+    for (int i = 0; i < 4; ++i) {
+        starters.emplace_back([] { start_err_trace(); });
+    }
+    for (std::thread& starter : starters) {
+        starter.join();
+    }
+    CHECK(detail::err_trace_state().previous_created.load() == &chained_hook);
+
+    detail::install_trace_hook(
+        detail::err_hook, detail::err_trace_state().previous_created, &detail::trace_err_created);
+    CHECK(detail::err_trace_state().previous_created.load() == &chained_hook);
+
+    CHECK(handle_once() == -1);
+    stop_err_trace();
+
+    CHECK(g_chained_calls == 1);
+    CHECK(set_err_hook(nullptr) == &chained_hook);
+    clear_err_trace();
+}
+
+TEST_CASE("stopping the error trace keeps hooks installed after it started") {
+    g_chained_calls = 0;
+    start_err_trace();
+    const ErrHook trace_hook = set_err_hook(&chained_hook);
+    stop_err_trace();
+
+    CHECK(handle_once() == -1);
+    CHECK(g_chained_calls == 1);
+    CHECK(set_err_hook(nullptr) == &chained_hook);
+    CHECK(trace_hook == &detail::trace_err_created);
+    clear_err_trace();
+}
+
+#if defined(__linux__)
+TEST_CASE("error trace reports operating system process and thread ids") {
+    clear_err_trace();
+    start_err_trace(64);
+
+    long worker_tid = 0;
+    std::thread worker{[&worker_tid] {
+        worker_tid = syscall(SYS_gettid);
+        static_cast<void>(handle_once());
+    }};
+    worker.join();
+
+    stop_err_trace();
+
+    std::ostringstream out;
+    write_chrome_trace(out);
+    const std::string json = out.str();
+
+    CHECK(json.find("\"pid\":" + std::to_string(getpid()) + ",") != std::string::npos);
+    CHECK(count_occurrences(json, "\"tid\":" + std::to_string(worker_tid) + ",") == 2);
+    clear_err_trace();
+}
+#endif
+
+TEST_CASE("error trace hands buffers of exited threads to new threads") {
+    clear_err_trace();
+    start_err_trace(64);
+
+    const auto record_on_new_thread = [] {
+        std::thread worker{[] { static_cast<void>(handle_once()); }};
+        worker.join();
+    };
+    record_on_new_thread();
+    const std::size_t buffers = detail::err_trace_state().buffers.size();
+    for (int i = 0; i < 8; ++i) {
+        record_on_new_thread();
+    }
+    CHECK(detail::err_trace_state().buffers.size() == buffers);
+
+    stop_err_trace();
+
+    std::ostringstream out;
+    write_chrome_trace(out);
+    CHECK(count_occurrences(out.str(), "\"name\":\"err_created\"") == 9);
+    clear_err_trace();
+}
@@ -0,0 +1,49 @@
+#include <feer/layout.hpp>
+
+#include FEER_LAYOUT_TYPES_HEADER
+
+#include <cstdio>
+#include <string_view>
+
+namespace {
+
+template <typename R>
+void print_row(std::string_view name) {
+    using layout = feer::result_layout<R>;
+    std::printf(
+        "%-40.*s %6zu %6zu %8zu %8zu %10s %10s %9s\n",
+        static_cast<int>(name.size()),
+        name.data(),
+        layout::size,
+        layout::align,
+        layout::payload_bytes,
+        layout::padding_bytes,
+        layout::trivially_copyable ? "yes" : "no",
+        layout::trivially_destructible ? "yes" : "no",
+        layout::sysv_register_returnable ? "yes" : "no");
+}
+
+}  // namespace
+
+int main() {
+    std::printf(
+        "%-40s %6s %6s %8s %8s %10s %10s %9s\n",
+        "type",
+        "size",
+        "align",
+        "payload",
+        "padding",
+        "triv-copy",
+        "triv-dtor",
+        "sysv-regs");
+
+    print_row<feer::Result<void>>("Result<void>");
+
+#define FEER_LAYOUT_ROW(...)                                         \
+    print_row<feer::Result<__VA_ARGS__>>("Result<" #__VA_ARGS__ ">");  \
+    print_row<feer::Result<__VA_ARGS__&>>("Result<" #__VA_ARGS__ "&>");
+    FEER_LAYOUT_TYPES(FEER_LAYOUT_ROW)
+#undef FEER_LAYOUT_ROW
+
+    return 0;
+}
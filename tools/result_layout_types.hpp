@@ -0,0 +1,22 @@
+#pragma once
+
+// Types reported by feer_result_layout. Point FEER_LAYOUT_TYPES_HEADER at your own header
+// (same shape: includes plus an FEER_LAYOUT_TYPES(X) list) to report your codebase's types.
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define FEER_LAYOUT_TYPES(X)     \
+    X(char)                      \
+    X(int)                       \
+    X(std::uint64_t)             \
+    X(double)                    \
+    X(void*)                     \
+    X(std::string)               \
+    X(std::vector<int>)          \
+    X(std::unique_ptr<int>)      \
+    X(std::array<char, 64>)      \
+    X(std::array<char, 1024>)